@@ -1122,6 +1122,15 @@ typedef uint32_t SlangSizeT;
 
         DiagnosticColor, // intValue0: SlangDiagnosticColor (always, never, auto)
 
+        EmitReflectionBinary,        // stringValue0: path to write binary reflection data to
+        PreoptimizeModuleIR,         // bool, run target-independent optimizations on module IR
+        LazyFunctionBodyChecking,    // bool, skip checking functions that nothing reachable uses
+        PrecompiledPreludeCachePath, // stringValue0: directory for precompiled prelude headers
+        DownstreamCompileCachePath,  // stringValue0: directory to cache downstream compiles in
+        DownstreamJobCount,          // intValue0: downstream compiles to run in the background
+        ReportDeclarationCosts,      // bool, report lowering time and IR size by declaration
+        SpecializeFullSweep,         // bool, revisit the whole module in every specialization sweep
+
         CountOf,
     };
 
@@ -4081,6 +4090,12 @@ struct IGlobalSession : public ISlangUnknown
         BuiltinModuleName module,
         SlangArchiveType archiveType,
         ISlangBlob** outBlob) = 0;
+
+    /** Free memory that the global session keeps around for reuse by later compilations,
+    such as pooled IR memory. Compilations in progress are not affected, and later
+    compilations allocate memory again as needed.
+    */
+    virtual SLANG_NO_THROW void SLANG_MCALL releaseUnusedMemory() = 0;
 };
 
     #define SLANG_UUID_IGlobalSession IGlobalSession::getTypeGuid()
@@ -4423,6 +4438,43 @@ struct ISession : public ISlangUnknown
         SlangInt& outModuleVersion,
         const char*& outModuleCompilerVersion,
         const char*& outModuleName) = 0;
+
+    /** Drop loaded modules whose source files have changed since they were loaded.
+
+        The contents of every file that a loaded module depends on (its own source and
+        any files it includes) are re-read through the session's file system and compared
+        with the contents the module was compiled from. A module is invalidated if any of
+        those files changed, or if it imports a module that is invalidated.
+
+        Invalidated modules are removed from the session, so that the next `loadModule`
+        (or `import`) of them compiles the current source. All other modules, and their
+        checked AST, IR and layouts, are kept and reused. Component types that were created
+        from an invalidated module keep referring to the old version of it; create new
+        ones from the reloaded modules to pick up the changes.
+
+        Modules that were loaded from a source string or blob whose path does not refer
+        to a file are never invalidated.
+
+        @param outInvalidatedModuleCount (optional) Receives the number of modules dropped.
+        @param outKeptModuleCount (optional) Receives the number of modules kept.
+     */
+    virtual SLANG_NO_THROW SlangResult SLANG_MCALL invalidateStaleModules(
+        SlangInt* outInvalidatedModuleCount,
+        SlangInt* outKeptModuleCount) = 0;
+
+    /** Get the report of what source declarations cost to compile, for sessions created
+        with the `ReportDeclarationCosts` option.
+
+        The report covers what was compiled with the session since the previous call (or
+        since the session was created). The costs collected so far are cleared, so that
+        each call reports on the work done since the one before.
+
+        @param maxEntryCount The most items to list in each section of the report.
+        @param outReport Receives the report as text.
+        @returns SLANG_E_NOT_AVAILABLE if the option is not enabled for the session.
+     */
+    virtual SLANG_NO_THROW SlangResult SLANG_MCALL
+    getDeclarationCostReport(SlangInt maxEntryCount, ISlangBlob** outReport) = 0;
 };
 
     #define SLANG_UUID_ISession ISession::getTypeGuid()
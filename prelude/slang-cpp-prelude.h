@@ -330,4 +330,17 @@ public:
 #define SLANG_UNROLL
 #endif
 
+// Placed on the innermost `groupThreadID` loop of a compute thread group, so consecutive
+// threads can be mapped onto SIMD lanes. Threads can write the same resource element or
+// groupshared value, so this must not promise the compiler that iterations are independent
+// (as `ivdep` does). `omp simd` only runs them in lock step, as the threads of a group would run
+// on a GPU. Without OpenMP the loop is left to the auto-vectorizer, which checks for itself.
+#ifndef SLANG_VECTORIZE_LOOP
+#if defined(_OPENMP) && (defined(__clang__) || defined(__GNUC__))
+#define SLANG_VECTORIZE_LOOP _Pragma("omp simd")
+#else
+#define SLANG_VECTORIZE_LOOP
+#endif
+#endif
+
 #endif
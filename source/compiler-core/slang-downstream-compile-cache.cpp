@@ -0,0 +1,338 @@
+// slang-downstream-compile-cache.cpp
+#include "slang-downstream-compile-cache.h"
+
+#include "../core/slang-blob.h"
+#include "../core/slang-crypto.h"
+#include "slang-artifact-associated-impl.h"
+#include "slang-artifact-desc-util.h"
+#include "slang-artifact-util.h"
+#include "slang-slice-allocator.h"
+
+namespace Slang
+{
+
+namespace
+{ // anonymous
+
+// An entry is stored as
+//
+// uint32 version, uint32 diagnostic count, string raw diagnostics,
+// { uint32 severity, uint32 stage, string text, string code, string file path, int64 line,
+//   int64 column } for each diagnostic,
+// followed by the bytes of the product up to the end of the entry.
+//
+// Strings are a uint32 byte count followed by the bytes.
+
+struct EntryWriter
+{
+    void write(const void* data, size_t size)
+    {
+        m_data.addRange((const uint8_t*)data, Index(size));
+    }
+    void writeUInt32(uint32_t value) { write(&value, sizeof(value)); }
+    void writeInt64(int64_t value) { write(&value, sizeof(value)); }
+    void writeString(const CharSlice& slice)
+    {
+        writeUInt32(uint32_t(slice.count));
+        write(slice.data, slice.count);
+    }
+
+    List<uint8_t> m_data;
+};
+
+struct EntryReader
+{
+    bool read(void* out, size_t size)
+    {
+        if (size > size_t(m_end - m_cur))
+            return false;
+        ::memcpy(out, m_cur, size);
+        m_cur += size;
+        return true;
+    }
+    bool readUInt32(uint32_t& out) { return read(&out, sizeof(out)); }
+    bool readInt64(int64_t& out) { return read(&out, sizeof(out)); }
+    bool readString(String& out)
+    {
+        uint32_t count;
+        if (!readUInt32(count) || count > size_t(m_end - m_cur))
+            return false;
+        out = String((const char*)m_cur, (const char*)m_cur + count);
+        m_cur += count;
+        return true;
+    }
+
+    const uint8_t* m_cur = nullptr;
+    const uint8_t* m_end = nullptr;
+};
+
+} // namespace
+
+static TerminatedCharSlice _asTerminatedCharSlice(const String& text)
+{
+    // An empty `String` has no buffer at all.
+    return text.getLength() ? SliceUtil::asTerminatedCharSlice(text) : TerminatedCharSlice();
+}
+
+DownstreamCompileCache::DownstreamCompileCache(const String& directory)
+    : m_directory(directory)
+{
+    PersistentCache::Desc desc;
+    desc.directory = m_directory.getBuffer();
+    m_cache = new PersistentCache(desc);
+}
+
+DownstreamCompileCache::Stats DownstreamCompileCache::getStats()
+{
+    return m_cache->getStats();
+}
+
+/* static */ SlangResult DownstreamCompileCache::calcKey(
+    IDownstreamCompiler* compiler,
+    const DownstreamCompileOptions& options,
+    Key& outKey)
+{
+    switch (options.targetType)
+    {
+    case SLANG_HOST_EXECUTABLE:
+    case SLANG_SHADER_SHARED_LIBRARY:
+    case SLANG_HOST_SHARED_LIBRARY:
+    case SLANG_SHADER_HOST_CALLABLE:
+    case SLANG_HOST_HOST_CALLABLE:
+        // These are used from the file system, or loaded into the process.
+        return SLANG_E_NOT_AVAILABLE;
+    default:
+        break;
+    }
+
+    // Anything the compiler could read that isn't part of the options would have to be in the key
+    // too, so just don't cache those compilations.
+    if (options.includePaths.count || options.libraries.count || options.libraryPaths.count ||
+        options.sourceArtifacts.count == 0)
+    {
+        return SLANG_E_NOT_AVAILABLE;
+    }
+
+    DigestBuilder<SHA1> builder;
+    builder.append(kEntryVersion);
+
+    // The compiler
+    {
+        const auto& desc = compiler->getDesc();
+        builder.append(desc.type);
+        builder.append(desc.version.m_major);
+        builder.append(desc.version.m_minor);
+        builder.append(desc.version.m_patch);
+
+        // Some compilers can identify the exact build they are.
+        ComPtr<ISlangBlob> versionBlob;
+        if (SLANG_SUCCEEDED(compiler->getVersionString(versionBlob.writeRef())) && versionBlob)
+        {
+            builder.append(versionBlob);
+        }
+    }
+
+    // The sources. The names go in too, as they can appear in diagnostics and debug info.
+    for (IArtifact* sourceArtifact : options.sourceArtifacts)
+    {
+        ComPtr<ISlangBlob> sourceBlob;
+        SLANG_RETURN_ON_FAIL(sourceArtifact->loadBlob(ArtifactKeep::Yes, sourceBlob.writeRef()));
+
+        const char* name = sourceArtifact->getName();
+        builder.append(UnownedStringSlice(name ? name : ""));
+        builder.append(uint64_t(sourceBlob->getBufferSize()));
+        builder.append(sourceBlob);
+    }
+
+    // The options
+    builder.append(options.optimizationLevel);
+    builder.append(options.debugInfoType);
+    builder.append(options.targetType);
+    builder.append(options.sourceLanguage);
+    builder.append(options.floatingPointMode);
+    builder.append(options.pipelineType);
+    builder.append(options.matrixLayout);
+    builder.append(options.flags);
+    builder.append(options.platform);
+    builder.append(options.enablePAQ);
+    builder.append(options.stage);
+    builder.append(options.m_debugInfoFormat);
+    builder.append(options.denormalModeFp16);
+    builder.append(options.denormalModeFp32);
+    builder.append(options.denormalModeFp64);
+
+    // Strings are appended with their length, so that adjacent strings can't run together.
+    auto appendString = [&](const CharSlice& slice)
+    {
+        builder.append(uint64_t(slice.count));
+        builder.append(asStringSlice(slice));
+    };
+
+    appendString(options.entryPointName);
+    appendString(options.profileName);
+
+    builder.append(uint64_t(options.defines.count));
+    for (const auto& define : options.defines)
+    {
+        appendString(define.nameWithSig);
+        appendString(define.value);
+    }
+
+    builder.append(uint64_t(options.requiredCapabilityVersions.count));
+    for (const auto& capabilityVersion : options.requiredCapabilityVersions)
+    {
+        builder.append(capabilityVersion.kind);
+        builder.append(capabilityVersion.version.m_major);
+        builder.append(capabilityVersion.version.m_minor);
+        builder.append(capabilityVersion.version.m_patch);
+    }
+
+    builder.append(uint64_t(options.compilerSpecificArguments.count));
+    for (const auto& arg : options.compilerSpecificArguments)
+    {
+        appendString(arg);
+    }
+
+    outKey = builder.finalize();
+    return SLANG_OK;
+}
+
+SlangResult DownstreamCompileCache::compile(
+    IDownstreamCompiler* compiler,
+    const DownstreamCompileOptions& options,
+    IArtifact** outArtifact)
+{
+    Key key;
+    if (SLANG_FAILED(calcKey(compiler, options, key)))
+    {
+        return compiler->compile(options, outArtifact);
+    }
+
+    const auto desc = ArtifactDescUtil::makeDescForCompileTarget(options.targetType);
+    if (SLANG_SUCCEEDED(_readEntry(key, desc, outArtifact)))
+    {
+        return SLANG_OK;
+    }
+
+    const SlangResult res = compiler->compile(options, outArtifact);
+    if (SLANG_SUCCEEDED(res) && *outArtifact)
+    {
+        _writeEntry(key, *outArtifact);
+    }
+    return res;
+}
+
+SlangResult DownstreamCompileCache::_readEntry(
+    const Key& key,
+    const ArtifactDesc& desc,
+    IArtifact** outArtifact)
+{
+    ComPtr<ISlangBlob> entryBlob;
+    SLANG_RETURN_ON_FAIL(m_cache->readEntry(key, entryBlob.writeRef()));
+
+    EntryReader reader;
+    reader.m_cur = (const uint8_t*)entryBlob->getBufferPointer();
+    reader.m_end = reader.m_cur + entryBlob->getBufferSize();
+
+    uint32_t version, diagnosticCount;
+    String raw;
+    if (!reader.readUInt32(version) || version != kEntryVersion ||
+        !reader.readUInt32(diagnosticCount) || !reader.readString(raw))
+    {
+        return SLANG_FAIL;
+    }
+
+    auto diagnostics = ArtifactDiagnostics::create();
+    diagnostics->setRaw(SliceUtil::asCharSlice(raw));
+
+    for (uint32_t i = 0; i < diagnosticCount; ++i)
+    {
+        uint32_t severity, stage;
+        String text, code, filePath;
+        int64_t line, column;
+        if (!reader.readUInt32(severity) || !reader.readUInt32(stage) || !reader.readString(text) ||
+            !reader.readString(code) || !reader.readString(filePath) || !reader.readInt64(line) ||
+            !reader.readInt64(column))
+        {
+            return SLANG_FAIL;
+        }
+
+        ArtifactDiagnostic diagnostic;
+        diagnostic.severity = ArtifactDiagnostic::Severity(severity);
+        diagnostic.stage = ArtifactDiagnostic::Stage(stage);
+        diagnostic.text = _asTerminatedCharSlice(text);
+        diagnostic.code = _asTerminatedCharSlice(code);
+        diagnostic.filePath = _asTerminatedCharSlice(filePath);
+        diagnostic.location.line = Int(line);
+        diagnostic.location.column = Int(column);
+
+        // `add` takes a copy of the strings.
+        diagnostics->add(diagnostic);
+    }
+
+    auto artifact = ArtifactUtil::createArtifact(desc);
+    artifact->addRepresentationUnknown(
+        RawBlob::create(reader.m_cur, size_t(reader.m_end - reader.m_cur)));
+    ArtifactUtil::addAssociated(artifact, diagnostics);
+
+    *outArtifact = artifact.detach();
+    return SLANG_OK;
+}
+
+void DownstreamCompileCache::_writeEntry(const Key& key, IArtifact* artifact)
+{
+    auto diagnostics = findAssociatedRepresentation<IArtifactDiagnostics>(artifact);
+    if (diagnostics &&
+        (SLANG_FAILED(diagnostics->getResult()) ||
+         diagnostics->hasOfAtLeastSeverity(ArtifactDiagnostic::Severity::Error)))
+    {
+        return;
+    }
+
+    // Only the product and its diagnostics are stored, so a compilation that produces anything
+    // else with them (such as separate debug info) would lose it when read back.
+    if (artifact->getChildren().count)
+    {
+        return;
+    }
+    for (IArtifact* associated : artifact->getAssociated())
+    {
+        if (associated->getDesc().payload != ArtifactPayload::Diagnostics)
+        {
+            return;
+        }
+    }
+
+    ComPtr<ISlangBlob> productBlob;
+    if (SLANG_FAILED(artifact->loadBlob(ArtifactKeep::Yes, productBlob.writeRef())))
+    {
+        return;
+    }
+
+    EntryWriter writer;
+    writer.writeUInt32(kEntryVersion);
+
+    const Count diagnosticCount = diagnostics ? diagnostics->getCount() : 0;
+    writer.writeUInt32(uint32_t(diagnosticCount));
+    writer.writeString(diagnostics ? diagnostics->getRaw() : TerminatedCharSlice());
+
+    for (Index i = 0; i < diagnosticCount; ++i)
+    {
+        const auto& diagnostic = *diagnostics->getAt(i);
+        writer.writeUInt32(uint32_t(diagnostic.severity));
+        writer.writeUInt32(uint32_t(diagnostic.stage));
+        writer.writeString(diagnostic.text);
+        writer.writeString(diagnostic.code);
+        writer.writeString(diagnostic.filePath);
+        writer.writeInt64(int64_t(diagnostic.location.line));
+        writer.writeInt64(int64_t(diagnostic.location.column));
+    }
+
+    writer.write(productBlob->getBufferPointer(), productBlob->getBufferSize());
+
+    m_cache->writeEntry(
+        key,
+        RawBlob::create(writer.m_data.getBuffer(), size_t(writer.m_data.getCount())));
+}
+
+} // namespace Slang
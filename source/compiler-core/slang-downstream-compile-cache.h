@@ -0,0 +1,64 @@
+// slang-downstream-compile-cache.h
+#ifndef SLANG_DOWNSTREAM_COMPILE_CACHE_H
+#define SLANG_DOWNSTREAM_COMPILE_CACHE_H
+
+#include "../core/slang-persistent-cache.h"
+#include "slang-downstream-compiler.h"
+
+namespace Slang
+{
+
+/* A content addressed cache of downstream compilations.
+
+An entry is keyed on the source, the identity and version of the downstream compiler, and all of
+the options that can change what it produces. The product and the diagnostics are stored in a
+`PersistentCache`, so compiling the same thing again (in this or any other process using the same
+directory) doesn't invoke the downstream compiler.
+
+Only compilations that are fully described by their options are cached. Products that are loaded
+from the file system (executables, shared libraries, host callables), and compilations that can
+read include paths or libraries are always passed to the compiler. Failed compilations, ones that
+report errors, and ones that produce other artifacts along with the product (such as separate
+debug info) aren't cached. */
+class DownstreamCompileCache : public RefObject
+{
+public:
+    typedef PersistentCache::Key Key;
+    typedef PersistentCache::Stats Stats;
+
+    /// Calculate the key for compiling `options` with `compiler`.
+    /// Returns SLANG_E_NOT_AVAILABLE if the compilation can't be cached.
+    static SlangResult calcKey(
+        IDownstreamCompiler* compiler,
+        const DownstreamCompileOptions& options,
+        Key& outKey);
+
+    /// Compile `options` with `compiler`, or return the result from the cache if there is one.
+    /// Behaves like `IDownstreamCompiler::compile`, so on failure `outArtifact` may still hold the
+    /// diagnostics.
+    SlangResult compile(
+        IDownstreamCompiler* compiler,
+        const DownstreamCompileOptions& options,
+        IArtifact** outArtifact);
+
+    /// Hits and misses since the cache was created.
+    Stats getStats();
+
+    const String& getDirectory() const { return m_directory; }
+
+    DownstreamCompileCache(const String& directory);
+
+protected:
+    SlangResult _readEntry(const Key& key, const ArtifactDesc& desc, IArtifact** outArtifact);
+    void _writeEntry(const Key& key, IArtifact* artifact);
+
+    /// Bumped whenever the layout of an entry changes.
+    static const uint32_t kEntryVersion = 1;
+
+    String m_directory;
+    RefPtr<PersistentCache> m_cache;
+};
+
+} // namespace Slang
+
+#endif
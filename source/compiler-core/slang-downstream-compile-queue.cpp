@@ -0,0 +1,176 @@
+// slang-downstream-compile-queue.cpp
+#include "slang-downstream-compile-queue.h"
+
+#include "../core/slang-file-system.h"
+#include "slang-slice-allocator.h"
+
+#include <chrono>
+
+namespace Slang
+{
+
+DownstreamCompileQueue::Job::Job(
+    IDownstreamCompiler* compiler,
+    const DownstreamCompileOptions& options,
+    DownstreamCompileCache* cache)
+    : m_compiler(compiler), m_cache(cache), m_options(options)
+{
+    // Take copies of everything the options refer to, so the caller's storage can go away
+    // whilst the job is running.
+    m_options.modulePath = _copy(options.modulePath);
+    m_options.entryPointName = _copy(options.entryPointName);
+    m_options.profileName = _copy(options.profileName);
+    m_options.precompiledHeaderSource = _copy(options.precompiledHeaderSource);
+    m_options.precompiledHeaderCachePath = _copy(options.precompiledHeaderCachePath);
+
+    m_options.includePaths = _copy(options.includePaths, m_includePaths);
+    m_options.libraryPaths = _copy(options.libraryPaths, m_libraryPaths);
+    m_options.compilerSpecificArguments =
+        _copy(options.compilerSpecificArguments, m_compilerSpecificArguments);
+
+    for (const auto& define : options.defines)
+    {
+        DownstreamCompileOptions::Define copy;
+        copy.nameWithSig = _copy(define.nameWithSig);
+        copy.value = _copy(define.value);
+        m_defines.add(copy);
+    }
+    m_options.defines = SliceUtil::asSlice(m_defines);
+
+    m_requiredCapabilityVersions.addRange(
+        options.requiredCapabilityVersions.data,
+        options.requiredCapabilityVersions.count);
+    m_options.requiredCapabilityVersions = SliceUtil::asSlice(m_requiredCapabilityVersions);
+
+    m_options.sourceArtifacts = _copy(options.sourceArtifacts, m_sourceArtifacts);
+    m_options.libraries = _copy(options.libraries, m_libraries);
+
+    // Neither of these can be used from another thread.
+    if (m_options.fileSystemExt)
+    {
+        m_options.fileSystemExt = OSFileSystem::getExtSingleton();
+    }
+    m_options.sourceManager = nullptr;
+}
+
+TerminatedCharSlice DownstreamCompileQueue::Job::_copy(const TerminatedCharSlice& slice)
+{
+    if (slice.count == 0)
+    {
+        return slice.data ? TerminatedCharSlice("") : TerminatedCharSlice();
+    }
+
+    // The contents of a `String` don't move when the list grows.
+    m_strings.add(asString(slice));
+    return SliceUtil::asTerminatedCharSlice(m_strings.getLast());
+}
+
+Slice<TerminatedCharSlice> DownstreamCompileQueue::Job::_copy(
+    const Slice<TerminatedCharSlice>& slices,
+    List<TerminatedCharSlice>& outStorage)
+{
+    for (const auto& slice : slices)
+    {
+        outStorage.add(_copy(slice));
+    }
+    return SliceUtil::asSlice(outStorage);
+}
+
+Slice<IArtifact*> DownstreamCompileQueue::Job::_copy(
+    const Slice<IArtifact*>& artifacts,
+    List<ComPtr<IArtifact>>& outStorage)
+{
+    for (IArtifact* artifact : artifacts)
+    {
+        outStorage.add(ComPtr<IArtifact>(artifact));
+    }
+    return SliceUtil::asSlice(outStorage);
+}
+
+void DownstreamCompileQueue::Job::_run()
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    m_result = m_cache ? m_cache->compile(m_compiler, m_options, m_artifact.writeRef())
+                       : m_compiler->compile(m_options, m_artifact.writeRef());
+
+    m_elapsedTime =
+        (std::chrono::high_resolution_clock::now() - startTime).count() * 0.000000001;
+}
+
+/* static */ bool DownstreamCompileQueue::canCompileOnThread(IDownstreamCompiler* compiler)
+{
+    if (compiler->isFileBased())
+    {
+        // Each compilation is a process of its own, with its own temporary files.
+        return true;
+    }
+
+    switch (compiler->getDesc().type)
+    {
+    case SLANG_PASS_THROUGH_DXC:
+        // A compiler instance is created for each compilation.
+    case SLANG_PASS_THROUGH_FXC:
+        // D3DCompile is documented as being thread safe.
+        return true;
+    default:
+        // glslang, LLVM, tint and the like have global state.
+        return false;
+    }
+}
+
+DownstreamCompileQueue::DownstreamCompileQueue(Count maxJobCount)
+    : m_maxJobCount(maxJobCount > 0 ? maxJobCount : 1)
+{
+}
+
+DownstreamCompileQueue::~DownstreamCompileQueue()
+{
+    // The threads refer to the jobs and the queue, so have to be finished with first.
+    wait();
+}
+
+RefPtr<DownstreamCompileQueue::Job> DownstreamCompileQueue::add(
+    IDownstreamCompiler* compiler,
+    const DownstreamCompileOptions& options,
+    DownstreamCompileCache* cache)
+{
+    RefPtr<Job> job = new Job(compiler, options, cache);
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [&]() { return m_runningCount < m_maxJobCount; });
+        ++m_runningCount;
+    }
+
+    // The thread only uses the job through a raw pointer, as reference counting a `RefObject`
+    // isn't thread safe. `m_jobs` keeps it alive until the thread has been joined.
+    Job* jobPtr = job;
+    jobPtr->m_thread = std::thread(
+        [this, jobPtr]()
+        {
+            jobPtr->_run();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_runningCount;
+            }
+            m_condition.notify_one();
+        });
+
+    m_jobs.add(job);
+    return job;
+}
+
+void DownstreamCompileQueue::wait()
+{
+    for (auto& job : m_jobs)
+    {
+        if (job->m_thread.joinable())
+        {
+            job->m_thread.join();
+        }
+    }
+    m_jobs.clear();
+}
+
+} // namespace Slang
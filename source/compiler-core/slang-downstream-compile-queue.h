@@ -0,0 +1,121 @@
+// slang-downstream-compile-queue.h
+#ifndef SLANG_DOWNSTREAM_COMPILE_QUEUE_H
+#define SLANG_DOWNSTREAM_COMPILE_QUEUE_H
+
+#include "slang-downstream-compile-cache.h"
+#include "slang-downstream-compiler.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Slang
+{
+
+/* Runs downstream compilations in the background, so that the caller can carry on (say generating
+the source for the next entry point) whilst the downstream compiler works.
+
+At most `maxJobCount` compilations run at once, each on a thread of its own. Adding a job when
+that many are running blocks until one of them finishes. Jobs are only ever read from the thread
+that added them, after `wait` has returned, so results (and any diagnostics the caller reports
+from them) can be handled in the order the jobs were added.
+
+Only compilers that can be used from more than one thread should be given to the queue, see
+`canCompileOnThread`. */
+class DownstreamCompileQueue : public RefObject
+{
+public:
+    class Job : public RefObject
+    {
+    public:
+        /// The result of the compilation. Only valid once the queue has been waited on.
+        SlangResult getResult() const { return m_result; }
+        /// The product of the compilation. As with `IDownstreamCompiler::compile`, this may hold
+        /// diagnostics even if the compilation failed.
+        IArtifact* getArtifact() const { return m_artifact; }
+        /// The time spent compiling in seconds
+        double getElapsedTime() const { return m_elapsedTime; }
+
+        IDownstreamCompiler* getCompiler() const { return m_compiler; }
+
+        Job(IDownstreamCompiler* compiler,
+            const DownstreamCompileOptions& options,
+            DownstreamCompileCache* cache);
+
+    protected:
+        friend class DownstreamCompileQueue;
+
+        TerminatedCharSlice _copy(const TerminatedCharSlice& slice);
+        Slice<TerminatedCharSlice> _copy(
+            const Slice<TerminatedCharSlice>& slices,
+            List<TerminatedCharSlice>& outStorage);
+        Slice<IArtifact*> _copy(
+            const Slice<IArtifact*>& artifacts,
+            List<ComPtr<IArtifact>>& outStorage);
+
+        void _run();
+
+        ComPtr<IDownstreamCompiler> m_compiler;
+        RefPtr<DownstreamCompileCache> m_cache;
+
+        // A copy of the options, which only refers to storage held by the job.
+        DownstreamCompileOptions m_options;
+
+        List<String> m_strings;
+        List<TerminatedCharSlice> m_includePaths;
+        List<TerminatedCharSlice> m_libraryPaths;
+        List<TerminatedCharSlice> m_compilerSpecificArguments;
+        List<DownstreamCompileOptions::Define> m_defines;
+        List<DownstreamCompileOptions::CapabilityVersion> m_requiredCapabilityVersions;
+        List<ComPtr<IArtifact>> m_sourceArtifacts;
+        List<ComPtr<IArtifact>> m_libraries;
+
+        SlangResult m_result = SLANG_FAIL;
+        ComPtr<IArtifact> m_artifact;
+        double m_elapsedTime = 0.0;
+
+        std::thread m_thread;
+    };
+
+    /// Returns true if `compiler` can compile on a thread other than the one that loaded it,
+    /// at the same time as other compilations.
+    ///
+    /// Compilers that run as a separate process can. Of the ones that are loaded into the process,
+    /// only those that create all of their state for each compilation can.
+    static bool canCompileOnThread(IDownstreamCompiler* compiler);
+
+    /// Start compiling `options` with `compiler`, through `cache` if it is set.
+    ///
+    /// The options (and everything they refer to) are copied, so only need to stay in scope for
+    /// the call. The file system and source manager aren't thread safe, so includes (if any) are
+    /// read directly from the OS file system.
+    RefPtr<Job> add(
+        IDownstreamCompiler* compiler,
+        const DownstreamCompileOptions& options,
+        DownstreamCompileCache* cache);
+
+    /// Wait for all of the jobs that have been added to finish.
+    void wait();
+
+    /// The number of jobs that have been added, but not waited on
+    Count getPendingCount() const { return m_jobs.getCount(); }
+
+    Count getMaxJobCount() const { return m_maxJobCount; }
+
+    DownstreamCompileQueue(Count maxJobCount);
+    ~DownstreamCompileQueue();
+
+protected:
+    Count m_maxJobCount;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    // Only accessed with m_mutex held
+    Count m_runningCount = 0;
+
+    List<RefPtr<Job>> m_jobs;
+};
+
+} // namespace Slang
+
+#endif
@@ -292,6 +292,12 @@ struct DownstreamCompileOptions
     FloatingPointDenormalMode denormalModeFp16 = FloatingPointDenormalMode::Any;
     FloatingPointDenormalMode denormalModeFp32 = FloatingPointDenormalMode::Any;
     FloatingPointDenormalMode denormalModeFp64 = FloatingPointDenormalMode::Any;
+
+    /// Text that every source starts with, such as the C++ prelude. Compilers that support
+    /// precompiled headers may build one from it, and use it in place of parsing the text.
+    TerminatedCharSlice precompiledHeaderSource;
+    /// Directory precompiled headers are kept in. Nothing is precompiled if it isn't set.
+    TerminatedCharSlice precompiledHeaderCachePath;
 };
 static_assert(std::is_trivially_copyable_v<DownstreamCompileOptions>);
 
@@ -3,6 +3,7 @@
 
 #include "../core/slang-char-util.h"
 #include "../core/slang-common.h"
+#include "../core/slang-crypto.h"
 #include "../core/slang-io.h"
 #include "../core/slang-shared-library.h"
 #include "../core/slang-string-slice-pool.h"
@@ -948,12 +949,10 @@ static SlangResult _parseGCCFamilyLine(
     return SLANG_OK;
 }
 
-/* static */ SlangResult GCCDownstreamCompilerUtil::calcArgs(
+/* static */ void GCCDownstreamCompilerUtil::calcCodeGenArgs(
     const CompileOptions& options,
     CommandLine& cmdLine)
 {
-    SLANG_ASSERT(options.modulePath.count);
-
     PlatformKind platformKind = (options.platform == PlatformKind::Unknown)
                                     ? PlatformUtil::getPlatformKind()
                                     : options.platform;
@@ -1044,11 +1043,6 @@ static SlangResult _parseGCCFamilyLine(
         break;
     }
 
-    if (options.flags & CompileOptions::Flag::Verbose)
-    {
-        cmdLine.addArg("-v");
-    }
-
     switch (options.floatingPointMode)
     {
     case FloatingPointMode::Default:
@@ -1068,23 +1062,11 @@ static SlangResult _parseGCCFamilyLine(
         }
     }
 
-    StringBuilder moduleFilePath;
-    SLANG_RETURN_ON_FAIL(ArtifactDescUtil::calcPathForDesc(
-        targetDesc,
-        asStringSlice(options.modulePath),
-        moduleFilePath));
-
-    cmdLine.addArg("-o");
-    cmdLine.addArg(moduleFilePath);
-
     switch (options.targetType)
     {
     case SLANG_SHADER_SHARED_LIBRARY:
     case SLANG_HOST_SHARED_LIBRARY:
         {
-            // Shared library
-            cmdLine.addArg("-shared");
-
             if (PlatformUtil::isFamily(PlatformFamily::Unix, platformKind))
             {
                 // Position independent
@@ -1092,17 +1074,6 @@ static SlangResult _parseGCCFamilyLine(
             }
             break;
         }
-    case SLANG_HOST_EXECUTABLE:
-        {
-            cmdLine.addArg("-rdynamic");
-            break;
-        }
-    case SLANG_OBJECT_CODE:
-        {
-            // Don't link, just produce object file
-            cmdLine.addArg("-c");
-            break;
-        }
     default:
         break;
     }
@@ -1128,6 +1099,59 @@ static SlangResult _parseGCCFamilyLine(
         cmdLine.addArg("-I");
         cmdLine.addArg(asString(include));
     }
+}
+
+/* static */ SlangResult GCCDownstreamCompilerUtil::calcArgs(
+    const CompileOptions& options,
+    CommandLine& cmdLine)
+{
+    SLANG_ASSERT(options.modulePath.count);
+
+    PlatformKind platformKind = (options.platform == PlatformKind::Unknown)
+                                    ? PlatformUtil::getPlatformKind()
+                                    : options.platform;
+
+    const auto targetDesc = ArtifactDescUtil::makeDescForCompileTarget(options.targetType);
+
+    calcCodeGenArgs(options, cmdLine);
+
+    if (options.flags & CompileOptions::Flag::Verbose)
+    {
+        cmdLine.addArg("-v");
+    }
+
+    StringBuilder moduleFilePath;
+    SLANG_RETURN_ON_FAIL(ArtifactDescUtil::calcPathForDesc(
+        targetDesc,
+        asStringSlice(options.modulePath),
+        moduleFilePath));
+
+    cmdLine.addArg("-o");
+    cmdLine.addArg(moduleFilePath);
+
+    switch (options.targetType)
+    {
+    case SLANG_SHADER_SHARED_LIBRARY:
+    case SLANG_HOST_SHARED_LIBRARY:
+        {
+            // Shared library
+            cmdLine.addArg("-shared");
+            break;
+        }
+    case SLANG_HOST_EXECUTABLE:
+        {
+            cmdLine.addArg("-rdynamic");
+            break;
+        }
+    case SLANG_OBJECT_CODE:
+        {
+            // Don't link, just produce object file
+            cmdLine.addArg("-c");
+            break;
+        }
+    default:
+        break;
+    }
 
     // Link options
     if (0) // && options.targetType != TargetType::Object)
@@ -1226,6 +1250,94 @@ static SlangResult _parseGCCFamilyLine(
     return SLANG_OK;
 }
 
+SlangResult GCCDownstreamCompiler::_requirePrecompiledHeader(
+    const CompileOptions& options,
+    String& outHeaderPath)
+{
+    CommandLine cmdLine(m_cmdLine);
+    Util::calcCodeGenArgs(options, cmdLine);
+
+    // Everything that goes into building the precompiled header goes into its name, so changing
+    // the prelude, the compiler or the options produces a new header, instead of reusing a stale
+    // one. The compiler also checks a precompiled header is compatible before using it, and
+    // falls back to parsing the header text if it isn't.
+    DigestBuilder<SHA1> builder;
+    builder.append(cmdLine.toString());
+    builder.append(m_desc.type);
+    builder.append(m_desc.version.m_major);
+    builder.append(m_desc.version.m_minor);
+    builder.append(m_desc.version.m_patch);
+    builder.append(asStringSlice(options.precompiledHeaderSource));
+    const auto digest = builder.finalize();
+
+    const String cacheDirectory = asString(options.precompiledHeaderCachePath);
+    Path::createDirectoryRecursive(cacheDirectory);
+
+    const String basePath = Path::combine(
+        cacheDirectory,
+        "slang-prelude-" + DigestUtil::digestToString(digest.data, sizeof(digest.data)));
+    const String headerPath = basePath + ".h";
+
+    // clang looks for a `.pch` next to an `-include`d header, gcc for a `.gch`.
+    const String pchPath = headerPath + (m_desc.type == SLANG_PASS_THROUGH_CLANG ? ".pch" : ".gch");
+
+    // If the header failed to build before, it will fail again, so don't pay for another attempt
+    // on every compile. The marker holds the compiler output from the failed build.
+    const String failedPath = basePath + ".failed";
+
+    // Other processes may be building the same header, so only look at (or write) the files
+    // while holding the lock. Once written, a precompiled header is never modified.
+    LockFile lockFile;
+    SLANG_RETURN_ON_FAIL(lockFile.open(basePath + ".lock"));
+    LockFileGuard lockGuard(lockFile);
+
+    if (File::exists(failedPath))
+        return SLANG_FAIL;
+
+    if (!File::exists(headerPath))
+    {
+        SLANG_RETURN_ON_FAIL(
+            File::writeAllText(headerPath, asString(options.precompiledHeaderSource)));
+    }
+
+    if (!File::exists(pchPath))
+    {
+        cmdLine.addArg("-x");
+        cmdLine.addArg("c++-header");
+        cmdLine.addArg(headerPath);
+        cmdLine.addArg("-o");
+        cmdLine.addArg(pchPath);
+
+        ExecuteResult exeRes;
+        if (SLANG_FAILED(ProcessUtil::execute(cmdLine, exeRes)) || exeRes.resultCode != 0)
+        {
+            File::remove(pchPath);
+            File::writeAllText(failedPath, exeRes.standardError);
+            return SLANG_FAIL;
+        }
+    }
+
+    outHeaderPath = headerPath;
+    return SLANG_OK;
+}
+
+SlangResult GCCDownstreamCompiler::calcArgs(const CompileOptions& options, CommandLine& cmdLine)
+{
+    SLANG_RETURN_ON_FAIL(Util::calcArgs(options, cmdLine));
+
+    // The precompiled header is only an optimization. If it can't be built the source is compiled
+    // as is, as it contains the prelude text too.
+    String headerPath;
+    if (options.precompiledHeaderSource.count && options.precompiledHeaderCachePath.count &&
+        options.sourceLanguage == SLANG_SOURCE_LANGUAGE_CPP &&
+        SLANG_SUCCEEDED(_requirePrecompiledHeader(options, headerPath)))
+    {
+        cmdLine.addArg("-include");
+        cmdLine.addArg(headerPath);
+    }
+    return SLANG_OK;
+}
+
 /* static */ SlangResult GCCDownstreamCompilerUtil::createCompiler(
     const ExecutableLocation& exe,
     ComPtr<IDownstreamCompiler>& outCompiler)
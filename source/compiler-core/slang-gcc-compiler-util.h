@@ -22,6 +22,11 @@ struct GCCDownstreamCompilerUtil : public DownstreamCompilerUtilBase
     /// Calculate gcc family compilers (including clang) cmdLine arguments from options
     static SlangResult calcArgs(const CompileOptions& options, CommandLine& cmdLine);
 
+    /// Calculate just the arguments that control how source is compiled (language, optimization,
+    /// defines, include paths...). A precompiled header has to be built with the same arguments
+    /// as the source that uses it.
+    static void calcCodeGenArgs(const CompileOptions& options, CommandLine& cmdLine);
+
     /// Parse ExecuteResult into diagnostics
     static SlangResult parseOutput(const ExecuteResult& exeRes, IArtifactDiagnostics* diagnostics);
 
@@ -57,11 +62,9 @@ public:
     typedef CommandLineDownstreamCompiler Super;
     typedef GCCDownstreamCompilerUtil Util;
 
-    // CommandLineCPPCompiler impl  - just forwards to the Util
-    virtual SlangResult calcArgs(const CompileOptions& options, CommandLine& cmdLine) SLANG_OVERRIDE
-    {
-        return Util::calcArgs(options, cmdLine);
-    }
+    // CommandLineCPPCompiler impl  - forwards to the Util, and adds the precompiled header
+    virtual SlangResult calcArgs(const CompileOptions& options, CommandLine& cmdLine)
+        SLANG_OVERRIDE;
     virtual SlangResult parseOutput(
         const ExecuteResult& exeResult,
         IArtifactDiagnostics* diagnostics) SLANG_OVERRIDE
@@ -81,6 +84,13 @@ public:
         : Super(desc)
     {
     }
+
+protected:
+    /// Builds a precompiled header from `options.precompiledHeaderSource` in
+    /// `options.precompiledHeaderCachePath`, unless it is there already. `outHeaderPath` is the
+    /// path of the header to `-include`, the compiler finds the precompiled header next to it.
+    /// A failed build is recorded next to the header, and isn't retried.
+    SlangResult _requirePrecompiledHeader(const CompileOptions& options, String& outHeaderPath);
 };
 
 } // namespace Slang
@@ -998,6 +998,18 @@ void SourceManager::addSourceFile(const String& uniqueIdentity, SourceFile* sour
     m_sourceFileMap.add(uniqueIdentity, sourceFile);
 }
 
+void SourceManager::unmapSourceFile(SourceFile* sourceFile)
+{
+    List<String> identities;
+    for (const auto& [uniqueIdentity, mappedFile] : m_sourceFileMap)
+    {
+        if (mappedFile == sourceFile)
+            identities.add(uniqueIdentity);
+    }
+    for (const auto& uniqueIdentity : identities)
+        m_sourceFileMap.remove(uniqueIdentity);
+}
+
 void SourceManager::addSourceFileIfNotExist(const String& uniqueIdentity, SourceFile* sourceFile)
 {
     if (findSourceFileRecursively(uniqueIdentity))
@@ -621,6 +621,11 @@ struct SourceManager
     void addSourceFile(const String& uniqueIdentity, SourceFile* sourceFile);
     void addSourceFileIfNotExist(const String& uniqueIdentity, SourceFile* sourceFile);
 
+    /// Stop finding `sourceFile` by its unique identity, so that the next load of the same
+    /// identity creates a new source file. `sourceFile` itself stays alive (and in
+    /// `getSourceFiles()`), because source locations may still refer to it.
+    void unmapSourceFile(SourceFile* sourceFile);
+
     // Maps a SourceLoc to an absolute location
     SourceLoc::RawValue getAbsoluteLocation(SourceLoc location) const;
 
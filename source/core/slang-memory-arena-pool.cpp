@@ -0,0 +1,169 @@
+#include "slang-memory-arena-pool.h"
+
+namespace Slang
+{
+
+MemoryArenaPool::MemoryArenaPool()
+    : MemoryArenaPool(Desc())
+{
+}
+
+MemoryArenaPool::MemoryArenaPool(const Desc& desc)
+    : m_desc(desc)
+{
+    SLANG_ASSERT(desc.minBlockPayloadSize <= desc.maxBlockPayloadSize);
+    m_stats.blockPayloadSize = desc.minBlockPayloadSize;
+}
+
+MemoryArenaPool::~MemoryArenaPool()
+{
+    for (auto arena : m_arenas)
+    {
+        delete arena;
+    }
+}
+
+void MemoryArenaPool::acquire(MemoryArena& ioArena)
+{
+    MemoryArena* pooledArena = nullptr;
+    size_t blockPayloadSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stats.acquireCount++;
+        blockPayloadSize = m_stats.blockPayloadSize;
+
+        if (m_arenas.getCount())
+        {
+            pooledArena = m_arenas.getLast();
+            m_arenas.removeLast();
+
+            m_stats.reuseCount++;
+            m_stats.pooledBytes -= pooledArena->calcTotalMemoryAllocated();
+        }
+    }
+
+    if (!pooledArena)
+    {
+        if (ioArena.getBlockPayloadSize() != blockPayloadSize)
+        {
+            ioArena.init(blockPayloadSize);
+        }
+        else
+        {
+            ioArena.deallocateAll();
+        }
+        return;
+    }
+
+    // Take over the pooled arena's blocks. Whatever `ioArena` held is
+    // freed along with the holder.
+    ioArena.swapWith(*pooledArena);
+    delete pooledArena;
+}
+
+void MemoryArenaPool::release(MemoryArena& ioArena)
+{
+    const size_t allocatedBytes = ioArena.calcTotalMemoryAllocated();
+
+    bool shouldPool = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stats.releaseCount++;
+
+        // Weight the running average towards recent arenas, so that the
+        // block size follows changes in the workload.
+        m_stats.averageArenaBytes = m_stats.releaseCount == 1
+                                        ? allocatedBytes
+                                        : (m_stats.averageArenaBytes * 7 + allocatedBytes) / 8;
+        _updateBlockPayloadSize();
+
+        // Arenas using an out of date block size are not kept, so that the
+        // pool converges on the adapted size.
+        shouldPool = m_arenas.getCount() < m_desc.maxPooledArenaCount &&
+                     allocatedBytes <= m_desc.maxRetainedBytesPerArena &&
+                     ioArena.getBlockPayloadSize() == m_stats.blockPayloadSize;
+
+        if (!shouldPool)
+        {
+            m_stats.discardCount++;
+        }
+    }
+
+    if (!shouldPool)
+    {
+        ioArena.reset();
+        return;
+    }
+
+    // Keep the regular blocks (odd sized blocks are freed) and move them
+    // into a holder owned by the pool.
+    ioArena.deallocateAll();
+
+    MemoryArena* pooledArena = new MemoryArena();
+    pooledArena->swapWith(ioArena);
+
+    const size_t pooledBytes = pooledArena->calcTotalMemoryAllocated();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Another thread may have filled the pool since we checked.
+        if (m_arenas.getCount() < m_desc.maxPooledArenaCount)
+        {
+            m_arenas.add(pooledArena);
+            m_stats.pooledBytes += pooledBytes;
+            pooledArena = nullptr;
+        }
+        else
+        {
+            m_stats.discardCount++;
+        }
+    }
+    delete pooledArena;
+}
+
+void MemoryArenaPool::trim()
+{
+    List<MemoryArena*> arenas;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        arenas.swapWith(m_arenas);
+        m_stats.pooledBytes = 0;
+    }
+
+    // Free the memory outside of the lock.
+    for (auto arena : arenas)
+    {
+        delete arena;
+    }
+}
+
+MemoryArenaPool::Stats MemoryArenaPool::getStats()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void MemoryArenaPool::_updateBlockPayloadSize()
+{
+    // Aim for arenas of the average size to need around 16 blocks,
+    // rounded down to a power of 2.
+    const size_t targetSize = m_stats.averageArenaBytes / 16;
+
+    size_t blockPayloadSize = m_desc.minBlockPayloadSize;
+    while (blockPayloadSize * 2 <= targetSize && blockPayloadSize * 2 <= m_desc.maxBlockPayloadSize)
+    {
+        blockPayloadSize *= 2;
+    }
+
+    // Every change of block size means pooled arenas get discarded, so only
+    // shrink once the workload has clearly moved to smaller arenas.
+    if (blockPayloadSize > m_stats.blockPayloadSize ||
+        blockPayloadSize * 4 <= m_stats.blockPayloadSize)
+    {
+        m_stats.blockPayloadSize = blockPayloadSize;
+    }
+}
+
+} // namespace Slang
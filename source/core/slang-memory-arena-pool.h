@@ -0,0 +1,90 @@
+#ifndef SLANG_CORE_MEMORY_ARENA_POOL_H
+#define SLANG_CORE_MEMORY_ARENA_POOL_H
+
+#include "slang-list.h"
+#include "slang-memory-arena.h"
+#include "slang-smart-pointer.h"
+
+#include <mutex>
+
+namespace Slang
+{
+
+/** A thread-safe pool of reset `MemoryArena`s.
+
+Code that repeatedly creates and destroys short-lived arenas (for example an `IRModule` per link)
+can `acquire` an arena from the pool, and `release` it when done. Released arenas keep their
+regular sized blocks, so a later `acquire` can allocate from them without going back to the heap.
+
+The block size of arenas created by the pool adapts to the observed size of released arenas, within
+`minBlockPayloadSize` and `maxBlockPayloadSize`, so that large workloads use fewer, larger blocks.
+Arenas that hold more than `maxRetainedBytesPerArena`, or that don't fit in the pool, are freed
+rather than kept, so the pool holds at most `maxPooledArenaCount * maxRetainedBytesPerArena` bytes.
+`trim` frees everything the pool holds.
+*/
+class MemoryArenaPool : public RefObject
+{
+public:
+    struct Desc
+    {
+        size_t minBlockPayloadSize = 16 * 1024;
+        size_t maxBlockPayloadSize = 256 * 1024;
+        /// The maximum number of arenas held by the pool.
+        Index maxPooledArenaCount = 4;
+        /// Arenas holding more than this many bytes when released are freed, not pooled.
+        size_t maxRetainedBytesPerArena = 4 * 1024 * 1024;
+    };
+
+    struct Stats
+    {
+        /// Total number of calls to `acquire`.
+        UInt acquireCount = 0;
+        /// Number of `acquire` calls that were satisfied by a pooled arena.
+        UInt reuseCount = 0;
+        /// Total number of calls to `release`.
+        UInt releaseCount = 0;
+        /// Number of released arenas that were freed instead of pooled.
+        UInt discardCount = 0;
+        /// The block payload size used for arenas the pool creates.
+        size_t blockPayloadSize = 0;
+        /// Running average of the bytes allocated by released arenas.
+        size_t averageArenaBytes = 0;
+        /// Bytes currently held by pooled arenas.
+        size_t pooledBytes = 0;
+    };
+
+    /// Set up `ioArena` to allocate from a pooled arena if one is available, or otherwise
+    /// reinitialize it with the pool's current block size. Any memory held by `ioArena` is freed.
+    void acquire(MemoryArena& ioArena);
+
+    /// Return the memory held by `ioArena` to the pool. `ioArena` is left empty.
+    ///
+    /// Nothing allocated from `ioArena` may be used after this call.
+    void release(MemoryArena& ioArena);
+
+    /// Free all of the arenas held by the pool. Arenas that are currently acquired are not
+    /// affected, and can still be released to the pool later.
+    void trim();
+
+    /// Get a snapshot of the pool's statistics.
+    Stats getStats();
+
+    MemoryArenaPool();
+    explicit MemoryArenaPool(const Desc& desc);
+    ~MemoryArenaPool();
+
+protected:
+    void _updateBlockPayloadSize();
+
+    std::mutex m_mutex;
+
+    Desc m_desc;
+    Stats m_stats;
+
+    /// Arenas that are reset and ready to be acquired.
+    List<MemoryArena*> m_arenas;
+};
+
+} // namespace Slang
+
+#endif
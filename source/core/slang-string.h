@@ -827,7 +827,7 @@ public:
     {
     }
     ImmutableHashedString(String&& str)
-        : slice(_Move(str)), hashCode(str.getHashCode())
+        : slice(_Move(str)), hashCode(slice.getHashCode())
     {
     }
     ImmutableHashedString(const ImmutableHashedString& other) = default;
@@ -848,6 +848,35 @@ public:
     HashCode64 getHashCode() const { return hashCode; }
 };
 
+/// Hash functor for containers keyed on `ImmutableHashedString`.
+///
+/// Together with `ImmutableHashedStringEqual` this allows such a container to be
+/// queried with an `UnownedStringSlice`, without first copying the slice into an
+/// owned `String` (and so allocating) just to perform the lookup.
+struct ImmutableHashedStringHash
+{
+    using is_transparent = void;
+    HashCode64 operator()(const ImmutableHashedString& str) const { return str.getHashCode(); }
+    HashCode64 operator()(const UnownedStringSlice& slice) const { return slice.getHashCode(); }
+};
+
+struct ImmutableHashedStringEqual
+{
+    using is_transparent = void;
+    bool operator()(const ImmutableHashedString& a, const ImmutableHashedString& b) const
+    {
+        return a == b;
+    }
+    bool operator()(const UnownedStringSlice& a, const ImmutableHashedString& b) const
+    {
+        return b == a;
+    }
+    bool operator()(const ImmutableHashedString& a, const UnownedStringSlice& b) const
+    {
+        return a == b;
+    }
+};
+
 class SLANG_RT_API StringBuilder : public String
 {
 private:
@@ -2,9 +2,11 @@
 #include "slang-llvm-builder.h"
 
 #include "slang-llvm-jit-shared-library.h"
+#include "slang-llvm-object-cache.h"
 
 #include "llvm/AsmParser/Parser.h"
 #include "llvm/CodeGen/CommandFlags.h"
+#include "llvm/ExecutionEngine/Orc/CompileUtils.h"
 #include "llvm/ExecutionEngine/Orc/LLJIT.h"
 #include "llvm/IR/BasicBlock.h"
 #include "llvm/IR/Constants.h"
@@ -31,6 +33,7 @@
 #include <compiler-core/slang-artifact-desc-util.h>
 #include <core/slang-blob.h>
 #include <core/slang-com-object.h>
+#include <core/slang-crypto.h>
 #include <core/slang-list.h>
 
 using namespace slang;
@@ -169,8 +172,14 @@ public:
     void addFPModeFlags();
 
     void optimize();
+    // Completes the module. This doesn't optimize it, which is left to `optimize` or, when
+    // JIT compiling, to the JIT on a cache miss.
     void finalize();
 
+    // Sets the module identifier to a hash of the module contents and the options that
+    // affect code generation. This is the key used by `LLVMJITObjectCache`.
+    void setContentHashModuleIdentifier();
+
     // This function inserts the given LLVM IR in the global scope.
     // Uses std::string due to that being what LLVM emits and ingests.
     void emitGlobalLLVMIR(const std::string& textIR);
@@ -651,7 +660,11 @@ void LLVMBuilder::addFPModeFlags()
     }
 }
 
-void LLVMBuilder::optimize()
+// Runs the optimization pipeline for `optLevel` on `module`.
+static void _optimizeModule(
+    llvm::Module& module,
+    llvm::TargetMachine* targetMachine,
+    SlangOptimizationLevel optLevel)
 {
     llvm::LoopAnalysisManager loopAnalysisManager;
     llvm::FunctionAnalysisManager functionAnalysisManager;
@@ -671,7 +684,7 @@ void LLVMBuilder::optimize()
 
     llvm::OptimizationLevel llvmLevel = llvm::OptimizationLevel::O0;
 
-    switch (options.optLevel)
+    switch (optLevel)
     {
     case SLANG_OPTIMIZATION_LEVEL_NONE:
         llvmLevel = llvm::OptimizationLevel::O0;
@@ -691,7 +704,12 @@ void LLVMBuilder::optimize()
     // Run the actual optimizations.
     llvm::ModulePassManager modulePassManager =
         passBuilder.buildPerModuleDefaultPipeline(llvmLevel);
-    modulePassManager.run(*llvmModule, moduleAnalysisManager);
+    modulePassManager.run(module, moduleAnalysisManager);
+}
+
+void LLVMBuilder::optimize()
+{
+    _optimizeModule(*llvmModule, targetMachine, options.optLevel);
 }
 
 void LLVMBuilder::finalize()
@@ -721,10 +739,6 @@ void LLVMBuilder::finalize()
 
     llvm::verifyModule(*llvmModule, &llvm::errs());
 
-    // O0 is separately handled inside `optimize()`; we need to call it in
-    // any case to make sure that `ForceInline` functions get inlined.
-    optimize();
-
     if (options.debugLevel != SLANG_DEBUG_INFO_LEVEL_NONE)
     {
         llvmDebugBuilder->finalize();
@@ -2242,6 +2256,9 @@ LLVMInst* LLVMBuilder::emitComputeEntryPointDispatcher(LLVMInst* workGroupFunc,
 SlangResult LLVMBuilder::generateAssembly(IArtifact** outArtifact)
 {
     finalize();
+    // O0 is separately handled inside `optimize()`; we need to call it in
+    // any case to make sure that `ForceInline` functions get inlined.
+    optimize();
 
     std::string out;
     llvm::raw_string_ostream rso(out);
@@ -2257,6 +2274,9 @@ SlangResult LLVMBuilder::generateAssembly(IArtifact** outArtifact)
 SlangResult LLVMBuilder::generateObjectCode(IArtifact** outArtifact)
 {
     finalize();
+    // O0 is separately handled inside `optimize()`; we need to call it in
+    // any case to make sure that `ForceInline` functions get inlined.
+    optimize();
 
     List<uint8_t> objectData;
     BinaryLLVMOutputStream output(objectData);
@@ -2285,13 +2305,107 @@ SlangResult LLVMBuilder::generateObjectCode(IArtifact** outArtifact)
     return SLANG_OK;
 }
 
+void LLVMBuilder::setContentHashModuleIdentifier()
+{
+    // The textual form of the module before optimization, together with the options that
+    // affect optimization and codegen, identify the object code produced for it.
+    std::string text;
+    llvm::raw_string_ostream textStream(text);
+    llvmModule->print(textStream, nullptr);
+
+    DigestBuilder<SHA1> builder;
+    builder.append(text.data(), SlangInt(text.size()));
+    builder.append(options.target);
+    builder.append(options.optLevel);
+    builder.append(options.fpMode);
+    builder.append(UnownedStringSlice(options.cpu.begin(), options.cpu.count));
+    builder.append(UnownedStringSlice(options.features.begin(), options.features.count));
+    for (TerminatedCharSlice arg : options.llvmArguments)
+        builder.append(UnownedStringSlice(arg.begin(), arg.count));
+
+    // The JIT compiles for the host it detects, rather than the cpu in the options, so the
+    // detected cpu and features are part of the key too. Otherwise a cache directory shared
+    // between machines could hand out code for a different cpu.
+    if (auto hostMachineBuilder = llvm::orc::JITTargetMachineBuilder::detectHost())
+    {
+        const std::string& hostCPU = hostMachineBuilder->getCPU();
+        const std::string hostFeatures = hostMachineBuilder->getFeatures().getString();
+        builder.append(UnownedStringSlice(hostCPU.data(), hostCPU.size()));
+        builder.append(UnownedStringSlice(hostFeatures.data(), hostFeatures.size()));
+    }
+    else
+    {
+        llvm::consumeError(hostMachineBuilder.takeError());
+    }
+
+    String identifier = LLVMJITObjectCache::getModuleIdentifier(builder.finalize());
+    llvmModule->setModuleIdentifier(identifier.getBuffer());
+}
+
+/* Compiles the modules added to a JIT, sharing object code through `LLVMJITObjectCache`.
+
+The cache is checked before a module is optimized, so a hit skips optimization as well as codegen.
+Like `llvm::orc::ConcurrentIRCompiler`, a target machine is created for each module, so modules
+can be compiled on more than one thread. */
+class LLVMJITCachingCompiler : public llvm::orc::IRCompileLayer::IRCompiler
+{
+public:
+    LLVMJITCachingCompiler(
+        llvm::orc::JITTargetMachineBuilder targetMachineBuilder,
+        SlangOptimizationLevel optLevel)
+        : IRCompiler(llvm::orc::irManglingOptionsFromTargetOptions(
+              targetMachineBuilder.getOptions()))
+        , m_targetMachineBuilder(std::move(targetMachineBuilder))
+        , m_optLevel(optLevel)
+    {
+    }
+
+    llvm::Expected<std::unique_ptr<llvm::MemoryBuffer>> operator()(llvm::Module& module) override
+    {
+        LLVMJITObjectCache& cache = LLVMJITObjectCache::get();
+        if (auto object = cache.getObject(&module))
+            return std::move(object);
+
+        auto targetMachine = m_targetMachineBuilder.createTargetMachine();
+        if (!targetMachine)
+            return targetMachine.takeError();
+
+        // O0 is separately handled inside `_optimizeModule()`; we need to call it in
+        // any case to make sure that `ForceInline` functions get inlined.
+        _optimizeModule(module, targetMachine->get(), m_optLevel);
+
+        llvm::orc::SimpleCompiler compiler(**targetMachine);
+        auto object = compiler(module);
+        if (object)
+            cache.notifyObjectCompiled(&module, (*object)->getMemBufferRef());
+        return object;
+    }
+
+protected:
+    llvm::orc::JITTargetMachineBuilder m_targetMachineBuilder;
+    SlangOptimizationLevel m_optLevel;
+};
+
 SlangResult LLVMBuilder::generateJITLibrary(IArtifact** outArtifact)
 {
     finalize();
 
+    // Identical modules share their object code through the process wide object cache, so that
+    // only the first JIT of a module pays for optimization and codegen. The module is optimized
+    // by `LLVMJITCachingCompiler` on a miss.
+    setContentHashModuleIdentifier();
+
     std::unique_ptr<llvm::orc::LLJIT> jit;
     {
         llvm::orc::LLJITBuilder jitBuilder;
+        jitBuilder.setCompileFunctionCreator(
+            [optLevel = options.optLevel](llvm::orc::JITTargetMachineBuilder targetMachineBuilder)
+                -> llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>>
+            {
+                return std::make_unique<LLVMJITCachingCompiler>(
+                    std::move(targetMachineBuilder),
+                    optLevel);
+            });
         llvm::Expected<std::unique_ptr<llvm::orc::LLJIT>> expectJit = jitBuilder.create();
 
         if (!expectJit)
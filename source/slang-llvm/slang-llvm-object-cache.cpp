@@ -0,0 +1,135 @@
+#include "slang-llvm-object-cache.h"
+
+#include "llvm/IR/Module.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#include <core/slang-blob.h>
+#include <core/slang-platform.h>
+
+namespace slang_llvm
+{
+
+using namespace Slang;
+
+LLVMJITObjectCache::LLVMJITObjectCache()
+{
+    StringBuilder cachePath;
+    if (SLANG_SUCCEEDED(PlatformUtil::getEnvironmentVariable(
+            UnownedStringSlice("SLANG_LLVM_OBJECT_CACHE_PATH"),
+            cachePath)) &&
+        cachePath.getLength())
+    {
+        PersistentCache::Desc desc;
+        desc.directory = cachePath.getBuffer();
+        m_persistentCache = new PersistentCache(desc);
+    }
+}
+
+/* static */ LLVMJITObjectCache& LLVMJITObjectCache::get()
+{
+    static LLVMJITObjectCache cache;
+    return cache;
+}
+
+bool LLVMJITObjectCache::_getKey(const llvm::Module* module, Key& outKey)
+{
+    // Only modules the builder has given a content hash identifier take part in caching.
+    const std::string& identifier = module->getModuleIdentifier();
+    return DigestUtil::stringToDigest(
+        identifier.c_str(),
+        SlangInt(identifier.length()),
+        outKey.data,
+        sizeof(outKey.data));
+}
+
+void LLVMJITObjectCache::notifyObjectCompiled(
+    const llvm::Module* module,
+    llvm::MemoryBufferRef obj)
+{
+    Key key;
+    if (!_getKey(module, key))
+        return;
+
+    ComPtr<ISlangBlob> blob = RawBlob::create(obj.getBufferStart(), obj.getBufferSize());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_persistentCache)
+    {
+        m_persistentCache->writeEntry(key, blob);
+        return;
+    }
+
+    const Count byteCount = Count(blob->getBufferSize());
+    if (m_entries.containsKey(key) || byteCount > kMaxInMemoryByteCount)
+        return;
+
+    while (m_entryOrder.getCount() >= kMaxInMemoryEntryCount ||
+           m_stats.entryByteCount + byteCount > kMaxInMemoryByteCount)
+    {
+        auto oldestNode = m_entryOrder.getFirstNode();
+        if (auto oldestBlob = m_entries.tryGetValue(oldestNode->value))
+            m_stats.entryByteCount -= Count((*oldestBlob)->getBufferSize());
+        m_entries.remove(oldestNode->value);
+        oldestNode->removeAndDelete();
+    }
+
+    m_entries.add(key, blob);
+    m_entryOrder.addLast(key);
+    m_stats.entryByteCount += byteCount;
+    m_stats.entryCount = m_entries.getCount();
+}
+
+std::unique_ptr<llvm::MemoryBuffer> LLVMJITObjectCache::getObject(const llvm::Module* module)
+{
+    Key key;
+    if (!_getKey(module, key))
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    ComPtr<ISlangBlob> blob;
+    if (m_persistentCache)
+    {
+        m_persistentCache->readEntry(key, blob.writeRef());
+    }
+    else if (auto entry = m_entries.tryGetValue(key))
+    {
+        blob = *entry;
+    }
+
+    if (!blob)
+    {
+        m_stats.missCount++;
+        return nullptr;
+    }
+
+    m_stats.hitCount++;
+
+    // The JIT takes ownership of the returned buffer, so hand it a copy.
+    return llvm::MemoryBuffer::getMemBufferCopy(
+        llvm::StringRef((const char*)blob->getBufferPointer(), blob->getBufferSize()),
+        module->getModuleIdentifier());
+}
+
+LLVMJITObjectCache::Stats LLVMJITObjectCache::getStats()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+} // namespace slang_llvm
+
+extern "C" SLANG_DLL_EXPORT SlangResult getLLVMJITObjectCacheStats_V1(
+    uint64_t* outHitCount,
+    uint64_t* outMissCount,
+    uint64_t* outEntryCount,
+    uint64_t* outEntryByteCount)
+{
+    const auto stats = slang_llvm::LLVMJITObjectCache::get().getStats();
+    *outHitCount = uint64_t(stats.hitCount);
+    *outMissCount = uint64_t(stats.missCount);
+    *outEntryCount = uint64_t(stats.entryCount);
+    *outEntryByteCount = uint64_t(stats.entryByteCount);
+    return SLANG_OK;
+}
@@ -0,0 +1,79 @@
+#ifndef SLANG_LLVM_OBJECT_CACHE_H
+#define SLANG_LLVM_OBJECT_CACHE_H
+
+#include "llvm/ExecutionEngine/ObjectCache.h"
+
+#include <core/slang-crypto.h>
+#include <core/slang-dictionary.h>
+#include <core/slang-linked-list.h>
+#include <core/slang-persistent-cache.h>
+
+#include <mutex>
+
+namespace slang_llvm
+{
+
+/* A process wide cache of JIT compiled object code.
+
+The JIT asks the cache for an object before optimizing a module, and hands every newly compiled
+object back to it. Modules are identified by their module identifier, which the builder sets to a
+content hash of the unoptimized module, the target options and the host cpu (see
+`LLVMBuilder::setContentHashModuleIdentifier`, and `_getKey` which reads it back). That means
+byte-identical modules compiled by different sessions or artifacts only pay for optimization and
+codegen once.
+
+Objects are held in memory, oldest evicted first once there are too many or they take up too much
+space. If the `SLANG_LLVM_OBJECT_CACHE_PATH` environment variable names a
+directory, objects are stored in a `PersistentCache` there instead, so they also survive the
+process. */
+class LLVMJITObjectCache : public llvm::ObjectCache
+{
+public:
+    typedef Slang::PersistentCache::Key Key;
+
+    struct Stats
+    {
+        // Number of objects that were found in the cache.
+        Slang::Count hitCount = 0;
+        // Number of objects that had to be compiled.
+        Slang::Count missCount = 0;
+        // Number of objects held in memory, and their total size in bytes.
+        Slang::Count entryCount = 0;
+        Slang::Count entryByteCount = 0;
+    };
+
+    // llvm::ObjectCache
+    void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef obj) override;
+    std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+    /// Get the cache key as a string suitable for use as a module identifier
+    static Slang::String getModuleIdentifier(const Key& key) { return key.toString(); }
+
+    /// Get the number of hits and misses so far, and the size of the in-memory cache
+    Stats getStats();
+
+    /// Get the cache shared by all JIT instances in the process
+    static LLVMJITObjectCache& get();
+
+protected:
+    LLVMJITObjectCache();
+
+    bool _getKey(const llvm::Module* module, Key& outKey);
+
+    // Limits on the objects held when there is no persistent cache.
+    static const Slang::Count kMaxInMemoryEntryCount = 1024;
+    static const Slang::Count kMaxInMemoryByteCount = 256 * 1024 * 1024;
+
+    std::mutex m_mutex;
+    Stats m_stats;
+
+    Slang::RefPtr<Slang::PersistentCache> m_persistentCache;
+
+    Slang::Dictionary<Key, Slang::ComPtr<ISlangBlob>> m_entries;
+    // Keys in insertion order, used to evict the oldest entries.
+    Slang::LinkedList<Key> m_entryOrder;
+};
+
+} // namespace slang_llvm
+
+#endif
@@ -485,6 +485,14 @@ SLANG_NO_THROW SlangResult SLANG_MCALL GlobalSessionRecorder::saveBuiltinModule(
     return res;
 }
 
+SLANG_NO_THROW void SLANG_MCALL GlobalSessionRecorder::releaseUnusedMemory()
+{
+    // No need to record this function. It only frees memory held for reuse, and it won't impact
+    // the results of any compilation.
+    slangRecordLog(LogLevel::Verbose, "%p: %s\n", m_actualGlobalSession.get(), __PRETTY_FUNCTION__);
+    m_actualGlobalSession->releaseUnusedMemory();
+}
+
 SLANG_NO_THROW SlangCapabilityID SLANG_MCALL GlobalSessionRecorder::findCapability(char const* name)
 {
     // No need to record this function. It's just a query function and it won't impact the internal
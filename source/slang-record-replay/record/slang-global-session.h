@@ -78,6 +78,8 @@ public:
         SlangArchiveType archiveType,
         ISlangBlob** outBlob) override;
 
+    SLANG_NO_THROW void SLANG_MCALL releaseUnusedMemory() override;
+
     SLANG_NO_THROW SlangCapabilityID SLANG_MCALL findCapability(char const* name) override;
 
     SLANG_NO_THROW void SLANG_MCALL setDownstreamCompilerForTransition(
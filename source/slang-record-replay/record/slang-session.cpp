@@ -563,6 +563,27 @@ SLANG_NO_THROW bool SessionRecorder::isBinaryModuleUpToDate(
     return result;
 }
 
+SLANG_NO_THROW SlangResult SessionRecorder::invalidateStaleModules(
+    SlangInt* outInvalidatedModuleCount,
+    SlangInt* outKeptModuleCount)
+{
+    // Not recorded: which modules are stale depends on the state of the file system
+    // at the time of the call, which a replay can't reproduce. Modules that get
+    // reloaded afterwards are recorded by the `loadModule` calls that load them.
+    slangRecordLog(LogLevel::Verbose, "%s\n", __PRETTY_FUNCTION__);
+    return m_actualSession->invalidateStaleModules(outInvalidatedModuleCount, outKeptModuleCount);
+}
+
+SLANG_NO_THROW SlangResult SessionRecorder::getDeclarationCostReport(
+    SlangInt maxEntryCount,
+    ISlangBlob** outReport)
+{
+    // No need to record this function, the report only describes the compilations that were
+    // done, and doesn't affect how later ones are done.
+    slangRecordLog(LogLevel::Verbose, "%s\n", __PRETTY_FUNCTION__);
+    return m_actualSession->getDeclarationCostReport(maxEntryCount, outReport);
+}
+
 IModuleRecorder* SessionRecorder::getModuleRecorder(slang::IModule* module)
 {
     IModuleRecorder* moduleRecord = nullptr;
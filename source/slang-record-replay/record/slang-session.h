@@ -91,6 +91,11 @@ public:
     SLANG_NO_THROW slang::IModule* SLANG_MCALL getLoadedModule(SlangInt index) override;
     SLANG_NO_THROW bool SLANG_MCALL
     isBinaryModuleUpToDate(const char* modulePath, slang::IBlob* binaryModuleBlob) override;
+    SLANG_NO_THROW SlangResult SLANG_MCALL invalidateStaleModules(
+        SlangInt* outInvalidatedModuleCount,
+        SlangInt* outKeptModuleCount) override;
+    SLANG_NO_THROW SlangResult SLANG_MCALL
+    getDeclarationCostReport(SlangInt maxEntryCount, ISlangBlob** outReport) override;
 
 private:
     SLANG_FORCE_INLINE slang::ISession* asExternal(SessionRecorder* session)
@@ -488,6 +488,9 @@ protected:
     Val* defaultResolveImpl();
 
 private:
+    /// Resolve a `Val` owned by a shared root builder, caching the result in `astBuilder`.
+    Val* _resolveShared(ASTBuilder* astBuilder, Index epoch);
+
     mutable Val* m_resolvedVal = nullptr;
     mutable Index m_resolvedValEpoch = 0;
 };
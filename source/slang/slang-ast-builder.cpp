@@ -58,107 +58,81 @@ SyntaxClass<NodeBase> SharedASTBuilder::findSyntaxClass(Name* name)
     return getSyntaxClass<NodeBase>();
 }
 
-Type* SharedASTBuilder::getStringType()
+Type* SharedASTBuilder::_getMagicDeclType(Type*& ioType, const char* magicName)
 {
-    if (!m_stringType)
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (!ioType)
     {
-        auto stringTypeDecl = findMagicDecl("StringType");
-        m_stringType = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(stringTypeDecl));
+        auto decl = findMagicDecl(magicName);
+        ioType = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(decl));
     }
-    return m_stringType;
+    return ioType;
+}
+
+Type* SharedASTBuilder::getStringType()
+{
+    return _getMagicDeclType(m_stringType, "StringType");
 }
 
 Type* SharedASTBuilder::getNativeStringType()
 {
-    if (!m_nativeStringType)
-    {
-        auto nativeStringTypeDecl = findMagicDecl("NativeStringType");
-        m_nativeStringType =
-            DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(nativeStringTypeDecl));
-    }
-    return m_nativeStringType;
+    return _getMagicDeclType(m_nativeStringType, "NativeStringType");
 }
 
 Type* SharedASTBuilder::getEnumTypeType()
 {
-    if (!m_enumTypeType)
-    {
-        auto enumTypeTypeDecl = findMagicDecl("EnumTypeType");
-        m_enumTypeType = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(enumTypeTypeDecl));
-    }
-    return m_enumTypeType;
+    return _getMagicDeclType(m_enumTypeType, "EnumTypeType");
 }
 
 Type* SharedASTBuilder::getDynamicType()
 {
-    if (!m_dynamicType)
-    {
-        auto dynamicTypeDecl = findMagicDecl("DynamicType");
-        m_dynamicType = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(dynamicTypeDecl));
-    }
-    return m_dynamicType;
+    return _getMagicDeclType(m_dynamicType, "DynamicType");
 }
 
 Type* SharedASTBuilder::getNullPtrType()
 {
-    if (!m_nullPtrType)
-    {
-        auto nullPtrTypeDecl = findMagicDecl("NullPtrType");
-        m_nullPtrType = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(nullPtrTypeDecl));
-    }
-    return m_nullPtrType;
+    return _getMagicDeclType(m_nullPtrType, "NullPtrType");
 }
 
 Type* SharedASTBuilder::getNoneType()
 {
-    if (!m_noneType)
-    {
-        auto noneTypeDecl = findMagicDecl("NoneType");
-        m_noneType = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(noneTypeDecl));
-    }
-    return m_noneType;
+    return _getMagicDeclType(m_noneType, "NoneType");
 }
 
 Type* SharedASTBuilder::getDiffInterfaceType()
 {
-    if (!m_diffInterfaceType)
-    {
-        auto decl = findMagicDecl("DifferentiableType");
-        m_diffInterfaceType = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(decl));
-    }
-    return m_diffInterfaceType;
+    return _getMagicDeclType(m_diffInterfaceType, "DifferentiableType");
 }
 
 Type* SharedASTBuilder::getIBufferDataLayoutType()
 {
-    if (!m_IBufferDataLayoutType)
-    {
-        auto decl = findMagicDecl("IBufferDataLayoutType");
-        m_IBufferDataLayoutType = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(decl));
-    }
-    return m_IBufferDataLayoutType;
+    return _getMagicDeclType(m_IBufferDataLayoutType, "IBufferDataLayoutType");
 }
 
 Type* SharedASTBuilder::getErrorType()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (!m_errorType)
         m_errorType = m_astBuilder->getOrCreate<ErrorType>();
     return m_errorType;
 }
 Type* SharedASTBuilder::getBottomType()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (!m_bottomType)
         m_bottomType = m_astBuilder->getOrCreate<BottomType>();
     return m_bottomType;
 }
 Type* SharedASTBuilder::getInitializerListType()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (!m_initializerListType)
         m_initializerListType = m_astBuilder->getOrCreate<InitializerListType>();
     return m_initializerListType;
 }
 Type* SharedASTBuilder::getOverloadedType()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (!m_overloadedType)
         m_overloadedType = m_astBuilder->getOrCreate<OverloadGroupType>();
     return m_overloadedType;
@@ -167,6 +141,7 @@ Type* SharedASTBuilder::getOverloadedType()
 void SharedASTBuilder::registerBuiltinDecl(Decl* decl, BuiltinTypeModifier* modifier)
 {
     auto type = DeclRefType::create(m_astBuilder, makeDeclRef<Decl>(decl));
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     m_builtinTypes[Index(modifier->tag)] = type;
 }
 
@@ -174,6 +149,7 @@ void SharedASTBuilder::registerBuiltinRequirementDecl(
     Decl* decl,
     BuiltinRequirementModifier* modifier)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     m_builtinRequirementDecls[modifier->kind] = decl;
 }
 
@@ -187,16 +163,19 @@ void SharedASTBuilder::registerMagicDecl(Decl* decl, MagicTypeModifier* modifier
     if (auto genericDecl = as<GenericDecl>(decl->parentDecl))
         declToRegister = genericDecl;
 
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     m_magicDecls[modifier->magicName] = declToRegister;
 }
 
 Decl* SharedASTBuilder::findMagicDecl(const String& name)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     return m_magicDecls.getValue(name);
 }
 
 Decl* SharedASTBuilder::tryFindMagicDecl(const String& name)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     auto d = m_magicDecls.tryGetValue(name);
     return d ? *d : nullptr;
 }
@@ -217,6 +196,9 @@ ASTBuilder::ASTBuilder(ASTBuilder* parent, String const& debugName)
 
     m_sharedASTBuilder = sharedASTBuilder;
     m_id = sharedASTBuilder->m_id++;
+
+    // Sessions (which are what child builders are created for) may run on different threads.
+    sharedASTBuilder->getInnerASTBuilder()->beginSharing();
 }
 
 ASTBuilder::ASTBuilder()
@@ -227,10 +209,16 @@ ASTBuilder::ASTBuilder()
 RootASTBuilder::RootASTBuilder(Session* globalSession)
     : m_sharedASTBuilderStorage(globalSession, this)
 {
+    m_sharedValCache.reset(new SharedValCacheShard[kSharedValCacheShardCount]);
     m_sharedASTBuilder = &m_sharedASTBuilderStorage;
     m_name = "RootASTBuilder";
 }
 
+void RootASTBuilder::beginSharing()
+{
+    m_isShared = true;
+}
+
 ASTBuilder::~ASTBuilder()
 {
     for (NodeBase* node : m_dtorNodes)
@@ -408,6 +396,11 @@ Val* ASTBuilder::_getOrCreateValDirectly(ValNodeDesc&& desc)
     //
     SLANG_ASSERT(this == _findAppropriateASTBuilderForVal(desc));
 
+    // The root builder may be used from several threads at once.
+    //
+    if (m_isShared)
+        return _getOrCreateSharedVal(_Move(desc));
+
     // We start by checking the cache. This might have
     // already been done as part of `_getOrCreateImpl()`,
     // but it is also possible that the `_getOrCreateImpl()`
@@ -431,6 +424,39 @@ Val* ASTBuilder::_getOrCreateValDirectly(ValNodeDesc&& desc)
     return node;
 }
 
+Val* ASTBuilder::_getOrCreateSharedVal(ValNodeDesc&& desc)
+{
+    // Only the stripe that `desc` hashes to is locked, so lookups
+    // (which are by far the common case once the core module types
+    // have been created) on other stripes can proceed in parallel.
+    //
+    // `Val`s created before the builder was shared are in `m_cachedNodes`,
+    // which is no longer written to, so it can be read without a lock.
+    //
+    if (auto found = m_cachedNodes.tryGetValue(desc))
+        return *found;
+
+    auto& shard = m_sharedValCache[Index(UInt64(desc.getHashCode()) % kSharedValCacheShardCount)];
+    std::lock_guard<std::mutex> shardLock(shard.mutex);
+
+    if (auto found = shard.nodes.tryGetValue(desc))
+        return *found;
+
+    // Allocation touches state shared by all stripes, and takes
+    // `m_sharedAllocMutex` only for as long as it needs to. That
+    // lock is never held while acquiring a stripe, so the two
+    // can't be taken in opposite orders.
+    //
+    auto node = as<Val>(desc.type.createInstance(this));
+    SLANG_ASSERT(node);
+    for (auto& operand : desc.operands)
+        node->m_operands.add(operand);
+
+    shard.nodes.add(ValKey(node), node);
+
+    return node;
+}
+
 Index ASTBuilder::getEpoch()
 {
     return getSharedASTBuilder()->m_session->m_epochId;
@@ -463,7 +489,10 @@ Type* ASTBuilder::getSpecializedBuiltinType(ArrayView<Val*> genericArgs, const c
 
 Type* ASTBuilder::getMagicEnumType(const char* magicEnumName)
 {
-    auto& cache = getSharedASTBuilder()->m_magicEnumTypes;
+    auto sharedASTBuilder = getSharedASTBuilder();
+    std::lock_guard<std::recursive_mutex> lock(sharedASTBuilder->m_mutex);
+
+    auto& cache = sharedASTBuilder->m_magicEnumTypes;
     Type* res = nullptr;
     if (!cache.tryGetValue(magicEnumName, res))
     {
@@ -8,6 +8,9 @@
 #include "slang-ast-support-types.h"
 #include "slang-ir.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 
 namespace Slang
@@ -60,6 +63,7 @@ public:
 
     Decl* findBuiltinRequirementDecl(BuiltinRequirementKind kind)
     {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
         return m_builtinRequirementDecls.getValue(kind);
     }
 
@@ -71,6 +75,7 @@ public:
 
     Name* getThisTypeName()
     {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
         if (!m_thisTypeName)
         {
             m_thisTypeName = getNamePool()->getName("This");
@@ -84,8 +89,22 @@ private:
     /// Initialize a shared AST builder owned by the given `rootASTBuilder`.
     SharedASTBuilder(Session* globalSession, RootASTBuilder* rootASTBuilder);
 
+    Type* _getMagicDeclType(Type*& ioType, const char* magicName);
+
 protected:
     // State shared between ASTBuilders
+    //
+    // Sessions on different threads share this state, and modules loaded
+    // on demand (such as `glsl`) can register more magic declarations while
+    // they do, so the lazily created types and the dictionaries below are
+    // only accessed with `m_mutex` held. The exception is `m_builtinTypes`,
+    // which is only written while the core module is loaded, before any
+    // session exists, and so can be read without it.
+    //
+    // The mutex is recursive, because creating a lazily created type can
+    // look up other magic declarations.
+    //
+    std::recursive_mutex m_mutex;
 
     Type* m_errorType = nullptr;
     Type* m_bottomType = nullptr;
@@ -132,7 +151,7 @@ protected:
 
     Session* m_session = nullptr;
 
-    Index m_id = 1;
+    std::atomic<Index> m_id{1};
 };
 
 struct ValKey
@@ -219,13 +238,17 @@ public:
     /// A cache for AST nodes that are entirely defined by their node type, with
     /// no need for additional state.
     ///
+    /// Once a `RootASTBuilder` is shared between sessions (see `m_isShared`)
+    /// its cache is no longer written to, and new `Val`s go in `m_sharedValCache`
+    /// instead, so the lookup above never races with another thread.
+    ///
     Dictionary<ValKey, Val*, Hash<ValKey>, ValKeyEqual> m_cachedNodes;
 
     /// Create AST types
     template<typename T>
     T* createImpl()
     {
-        auto alloced = m_arena.allocate(sizeof(T));
+        auto alloced = _allocateNode(sizeof(T));
         memset(alloced, 0, sizeof(T));
         auto result = _initAndAdd(new (alloced) T);
         return result;
@@ -234,7 +257,7 @@ public:
     template<typename T, typename... TArgs>
     T* createImpl(TArgs&&... args)
     {
-        auto alloced = m_arena.allocate(sizeof(T));
+        auto alloced = _allocateNode(sizeof(T));
         memset(alloced, 0, sizeof(T));
         auto result = _initAndAdd(new (alloced) T(std::forward<TArgs>(args)...));
         return result;
@@ -273,6 +296,19 @@ public:
 
     void incrementEpoch();
 
+    /// Is this a root builder that is shared between sessions (see `m_isShared`)?
+    bool isShared() const { return m_isShared; }
+
+    /// Results of `Val::resolve` for `Val`s allocated by a shared root builder.
+    ///
+    /// Sessions on different threads can resolve the same shared `Val`, so once
+    /// the root is shared the cache on the `Val` itself is only read, and each
+    /// session's builder caches its results here instead. Cleared when the epoch
+    /// changes.
+    ///
+    Dictionary<Val*, Val*> m_resolvedSharedVals;
+    Index m_resolvedSharedValsEpoch = 0;
+
     MemoryArena& getArena() { return m_arena; }
 
     NamePool* getNamePool() { return getSharedASTBuilder()->getNamePool(); }
@@ -747,6 +783,7 @@ private:
     Val* _getOrCreateImplSlowPath(ValNodeDesc&& desc);
     ASTBuilder* _findAppropriateASTBuilderForVal(ValNodeDesc const& desc);
     Val* _getOrCreateValDirectly(ValNodeDesc&& desc);
+    Val* _getOrCreateSharedVal(ValNodeDesc&& desc);
 
 protected:
     /// Default constructor.
@@ -756,6 +793,17 @@ protected:
     ///
     ASTBuilder();
 
+    /// Allocate storage for a node from `m_arena`.
+    void* _allocateNode(size_t size)
+    {
+        if (m_isShared)
+        {
+            std::lock_guard<std::mutex> lock(m_sharedAllocMutex);
+            return m_arena.allocate(size);
+        }
+        return m_arena.allocate(size);
+    }
+
     template<typename T>
     SLANG_FORCE_INLINE T* _initAndAdd(T* node)
     {
@@ -766,7 +814,15 @@ protected:
         if (!std::is_trivially_destructible<T>::value)
         {
             // Keep such that dtor can be run on ASTBuilder being dtored
-            m_dtorNodes.add(node);
+            if (m_isShared)
+            {
+                std::lock_guard<std::mutex> lock(m_sharedAllocMutex);
+                m_dtorNodes.add(node);
+            }
+            else
+            {
+                m_dtorNodes.add(node);
+            }
         }
         if (node->getClass().isSubClassOf(getSyntaxClass<Val>()))
         {
@@ -816,9 +872,42 @@ protected:
     List<NodeBase*> m_dtorNodes;
 
     /// Cache for CapabilitySet::freeze() to avoid recreating identical CapabilitySetVal objects
+    ///
+    /// Only accessed with `m_sharedAllocMutex` held while `m_isShared` is set.
+    ///
     Dictionary<CapabilitySet, CapabilitySetVal*> m_capabilitySetCache;
 
     MemoryArena m_arena;
+
+    /// One stripe of `m_sharedValCache`.
+    struct SharedValCacheShard
+    {
+        std::mutex mutex;
+        Dictionary<ValKey, Val*, Hash<ValKey>, ValKeyEqual> nodes;
+    };
+
+    static const Index kSharedValCacheShardCount = 32;
+
+    /// Lock-striped cache of the `Val`s allocated by this builder once it is shared.
+    ///
+    /// Only set for a `RootASTBuilder`. The root builder is shared by every
+    /// session created from the same global session, and those sessions may
+    /// be checking code on different threads. Striping the cache by hash code
+    /// lets threads intern unrelated `Val`s without contending on one lock.
+    ///
+    std::unique_ptr<SharedValCacheShard[]> m_sharedValCache;
+
+    /// Set once a `RootASTBuilder` has child builders, and so may be used from
+    /// more than one thread.
+    ///
+    /// Until then (which covers loading the core module) the root builder
+    /// works like any other, without taking locks. After that, `m_cachedNodes`
+    /// is only read, and state that is still written is guarded.
+    ///
+    std::atomic<bool> m_isShared{false};
+
+    /// Guards `m_arena`, `m_dtorNodes` and `m_capabilitySetCache` while `m_isShared` is set.
+    std::mutex m_sharedAllocMutex;
 };
 
 /// An `ASTBuilder` that is at the root of its own hierarchy.
@@ -838,6 +927,9 @@ public:
     ///
     RootASTBuilder(Session* globalSession);
 
+    /// Mark the builder as shared between sessions, which may use it from different threads.
+    void beginSharing();
+
 private:
     SharedASTBuilder m_sharedASTBuilderStorage;
 };
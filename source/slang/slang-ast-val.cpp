@@ -64,11 +64,16 @@ Val* Val::resolve()
     // If we are not in a proper checking context, just return the previously resolved val.
     if (!astBuilder)
         return m_resolvedVal ? m_resolvedVal : this;
-    if (m_resolvedVal && m_resolvedValEpoch == astBuilder->getEpoch())
+    const Index epoch = astBuilder->getEpoch();
+    if (m_resolvedVal && m_resolvedValEpoch == epoch)
     {
         SLANG_ASSERT(as<Val>(m_resolvedVal));
         return m_resolvedVal;
     }
+    // A `Val` owned by a shared root builder can be resolved on several threads at once, so its
+    // own cache isn't written to.
+    if (getASTBuilder() && getASTBuilder()->isShared())
+        return _resolveShared(astBuilder, epoch);
     // Update epoch now to avoid infinite recursion.
     m_resolvedValEpoch = astBuilder->getEpoch();
     m_resolvedVal = resolveImpl();
@@ -82,6 +87,29 @@ Val* Val::resolve()
     return m_resolvedVal;
 }
 
+Val* Val::_resolveShared(ASTBuilder* astBuilder, Index epoch)
+{
+    // The shared root builder is only current while it loads a builtin module, and has nowhere
+    // to keep per-thread results, so the val is resolved again each time.
+    if (astBuilder->isShared())
+        return resolveImpl();
+
+    if (astBuilder->m_resolvedSharedValsEpoch != epoch)
+    {
+        astBuilder->m_resolvedSharedVals.clear();
+        astBuilder->m_resolvedSharedValsEpoch = epoch;
+    }
+    if (auto found = astBuilder->m_resolvedSharedVals.tryGetValue(this))
+        return *found;
+
+    // Record the previous result now to avoid infinite recursion.
+    if (m_resolvedVal)
+        astBuilder->m_resolvedSharedVals[this] = m_resolvedVal;
+    auto resolvedVal = resolveImpl();
+    astBuilder->m_resolvedSharedVals[this] = resolvedVal;
+    return resolvedVal;
+}
+
 void Val::_setUnique()
 {
     m_resolvedVal = this;
@@ -1788,9 +1788,16 @@ CapabilitySet CapabilitySetVal::thaw() const
 
 [[nodiscard]] CapabilitySetVal* CapabilitySet::freeze(ASTBuilder* astBuilder) const
 {
-    if (auto cached = astBuilder->m_capabilitySetCache.tryGetValue(*this))
     {
-        return *cached;
+        // A root builder shared between sessions guards its cache, but the lock is not held
+        // while creating the `Val`s below, which takes locks of its own.
+        std::unique_lock<std::mutex> lock(astBuilder->m_sharedAllocMutex, std::defer_lock);
+        if (astBuilder->m_isShared)
+            lock.lock();
+        if (auto cached = astBuilder->m_capabilitySetCache.tryGetValue(*this))
+        {
+            return *cached;
+        }
     }
     SLANG_PROFILE_CAPABILITY_SETS;
 
@@ -1855,10 +1862,25 @@ CapabilitySet CapabilitySetVal::thaw() const
     }
 
     auto result = astBuilder->getOrCreate<CapabilitySetVal>(targetSetVals);
-    result->cachedThawedCapabilitySet = *this;
+
+    // `result` can belong to a root builder shared between sessions even if `astBuilder`
+    // isn't, so the builder that owns it guards it.
+    {
+        auto resultASTBuilder = result->getASTBuilder();
+        std::unique_lock<std::mutex> lock(resultASTBuilder->m_sharedAllocMutex, std::defer_lock);
+        if (resultASTBuilder->m_isShared)
+            lock.lock();
+        if (!result->cachedThawedCapabilitySet.has_value())
+            result->cachedThawedCapabilitySet = *this;
+    }
 
     // Cache the result for future lookups
-    astBuilder->m_capabilitySetCache.add(*this, result);
+    {
+        std::unique_lock<std::mutex> lock(astBuilder->m_sharedAllocMutex, std::defer_lock);
+        if (astBuilder->m_isShared)
+            lock.lock();
+        astBuilder->m_capabilitySetCache.addIfNotExists(*this, result);
+    }
 
     return result;
 }
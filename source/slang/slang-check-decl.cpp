@@ -12,6 +12,8 @@
 // logic also orchestrates the overall flow and how
 // and when things get checked.
 
+#include "../core/slang-char-util.h"
+#include "../core/slang-performance-profiler.h"
 #include "slang-ast-forward-declarations.h"
 #include "slang-ast-iterator.h"
 #include "slang-ast-print.h"
@@ -1598,6 +1600,16 @@ void SemanticsVisitor::ensureDecl(Decl* decl, DeclCheckState state, SemanticsCon
 ///
 void SemanticsVisitor::ensureAllDeclsRec(Decl* decl, DeclCheckState state)
 {
+    // Functions found to be unreachable are only checked up to their signature,
+    // unless something asks for their definition directly through `ensureDecl`.
+    //
+    if (state >= DeclCheckState::DefinitionChecked)
+    {
+        auto translationUnit = getShared()->getTranslationUnitRequest();
+        if (translationUnit && translationUnit->unreachableFuncDecls.contains(decl))
+            return;
+    }
+
     // Ensure `decl` itself first.
     ensureDecl(decl, state);
 
@@ -3962,6 +3974,159 @@ void discoverExtensionDecls(List<ExtensionDecl*>& decls, Decl* parent)
     }
 }
 
+/// A module-scope function that lazy function body checking may leave unchecked.
+struct LazyFuncCandidate
+{
+    /// The declaration as it appears in its container (a `GenericDecl` for generic functions).
+    Decl* decl;
+    Name* name;
+    UnparsedStmt* body;
+};
+
+/// Collect the functions under `containerDecl` whose bodies may be left unchecked.
+///
+/// We only consider plain functions that are not visible outside the module, and that carry
+/// no modifiers other than visibility or `inline`. Anything with attributes (entry points,
+/// `[ForceInline]`, autodiff, ...), semantics or linkage modifiers is always checked.
+///
+/// Operator overloads are always checked too. They are named after their operator token,
+/// which is never counted as a use of the name, since uses are found through identifiers.
+///
+static void _collectLazyFuncCandidates(
+    ContainerDecl* containerDecl,
+    List<LazyFuncCandidate>& outCandidates)
+{
+    for (auto memberDecl : containerDecl->getDirectMemberDecls())
+    {
+        if (as<FileDecl>(memberDecl) || as<NamespaceDecl>(memberDecl))
+        {
+            _collectLazyFuncCandidates(as<ContainerDecl>(memberDecl), outCandidates);
+            continue;
+        }
+
+        Decl* innerDecl = memberDecl;
+        if (auto genericDecl = as<GenericDecl>(memberDecl))
+            innerDecl = genericDecl->inner;
+
+        auto funcDecl = as<FuncDecl>(innerDecl);
+        if (!funcDecl || !funcDecl->getName())
+            continue;
+        const auto nameText = funcDecl->getName()->text.getUnownedSlice();
+        if (!nameText.getLength() || !(CharUtil::isAlpha(nameText[0]) || nameText[0] == '_'))
+            continue;
+        auto body = as<UnparsedStmt>(funcDecl->body);
+        if (!body)
+            continue;
+        if (getDeclVisibility(memberDecl) >= DeclVisibility::Public)
+            continue;
+
+        bool hasOtherModifiers = false;
+        for (auto modifier : funcDecl->modifiers)
+        {
+            if (!as<VisibilityModifier>(modifier) && !as<InlineModifier>(modifier))
+            {
+                hasOtherModifiers = true;
+                break;
+            }
+        }
+        if (hasOtherModifiers)
+            continue;
+
+        outCandidates.add(LazyFuncCandidate{memberDecl, funcDecl->getName(), body});
+    }
+}
+
+/// Get the name of an identifier `token`, the same way the parser counts it.
+static Name* _getIdentifierName(NamePool* namePool, const Token& token)
+{
+    if (token.type != TokenType::Identifier)
+        return nullptr;
+    if (auto name = token.getNameOrNull())
+        return name;
+    return namePool->getName(token.getContent());
+}
+
+/// Find the module-scope functions in `moduleDecl` that nothing reachable refers to.
+///
+/// Reachability is decided by name: a function is reachable if its name is used anywhere in
+/// the module outside the bodies of candidate functions, if it is requested as an entry point,
+/// or if it is used in the body of a reachable candidate. Using names rather than resolved
+/// declarations over-approximates (any use of a name keeps all overloads of it), but lets us
+/// decide before any body is checked.
+///
+static void _findUnreachableFuncDecls(
+    TranslationUnitRequest* translationUnit,
+    ModuleDecl* moduleDecl)
+{
+    List<LazyFuncCandidate> candidates;
+    _collectLazyFuncCandidates(moduleDecl, candidates);
+    if (!candidates.getCount())
+        return;
+
+    auto namePool = translationUnit->getNamePool();
+
+    // Count the uses of each name outside of the candidates, by removing the
+    // tokens that belong to the candidates from the counts for the whole module.
+    //
+    Dictionary<Name*, Count> outsideUseCounts = translationUnit->identifierTokenCounts;
+    Dictionary<Name*, List<Index>> mapNameToCandidates;
+    for (Index i = 0; i < candidates.getCount(); ++i)
+    {
+        const auto& candidate = candidates[i];
+        mapNameToCandidates[candidate.name].add(i);
+
+        // The name of the function in its own declaration is not a use.
+        outsideUseCounts[candidate.name]--;
+        for (const auto& token : candidate.body->tokens)
+        {
+            if (auto name = _getIdentifierName(namePool, token))
+                outsideUseCounts[name]--;
+        }
+    }
+
+    HashSet<Name*> reachedNames;
+    List<Name*> workList;
+    auto reachName = [&](Name* name)
+    {
+        if (mapNameToCandidates.containsKey(name) && reachedNames.add(name))
+            workList.add(name);
+    };
+
+    for (const auto& [name, count] : outsideUseCounts)
+    {
+        if (count > 0)
+            reachName(name);
+    }
+    if (auto compileRequest = translationUnit->compileRequest)
+    {
+        for (auto entryPointReq : compileRequest->getEntryPointReqs())
+        {
+            if (entryPointReq->getTranslationUnit() == translationUnit)
+                reachName(entryPointReq->getName());
+        }
+    }
+
+    while (workList.getCount())
+    {
+        auto name = workList.getLast();
+        workList.removeLast();
+        for (auto index : mapNameToCandidates[name])
+        {
+            for (const auto& token : candidates[index].body->tokens)
+            {
+                if (auto usedName = _getIdentifierName(namePool, token))
+                    reachName(usedName);
+            }
+        }
+    }
+
+    for (const auto& candidate : candidates)
+    {
+        if (!reachedNames.contains(candidate.name))
+            translationUnit->unreachableFuncDecls.add(candidate.decl);
+    }
+}
+
 void SemanticsDeclVisitorBase::checkModule(ModuleDecl* moduleDecl)
 {
     // When we are dealing with code from the core modules,
@@ -4108,6 +4273,21 @@ void SemanticsDeclVisitorBase::checkModule(ModuleDecl* moduleDecl)
         DeclCheckState::CapabilityChecked,
     };
 
+    // With lazy function body checking, functions that nothing reachable refers
+    // to are skipped by `ensureAllDeclsRec` once it gets to checking definitions.
+    // Their bodies stay unparsed, so diagnostics in them are not reported.
+    //
+    if (auto translationUnit = getShared()->getTranslationUnitRequest())
+    {
+        auto compileRequest = translationUnit->compileRequest;
+        if (compileRequest && compileRequest->allowLazyFunctionBodySkipping &&
+            compileRequest->optionSet.getBoolOption(CompilerOptionName::LazyFunctionBodyChecking) &&
+            !compileRequest->getLinkage()->isInLanguageServer())
+        {
+            _findUnreachableFuncDecls(translationUnit, moduleDecl);
+        }
+    }
+
     // Discover and check all extension decls before anything else.
     List<ExtensionDecl*> extensionDecls;
     discoverExtensionDecls(extensionDecls, moduleDecl);
@@ -4140,7 +4320,18 @@ void SemanticsDeclVisitorBase::checkModule(ModuleDecl* moduleDecl)
         // to the subset of declarations coming from a given source
         // file.
         //
-        ensureAllDeclsRec(moduleDecl, s);
+        // The signature and definition passes are profiled separately.
+        //
+        if (s < DeclCheckState::DefinitionChecked)
+        {
+            SLANG_PROFILE_SECTION(checkDeclSignatures);
+            ensureAllDeclsRec(moduleDecl, s);
+        }
+        else
+        {
+            SLANG_PROFILE_SECTION(checkDeclDefinitions);
+            ensureAllDeclsRec(moduleDecl, s);
+        }
     }
 
     // Once we have completed the above loop, all declarations not
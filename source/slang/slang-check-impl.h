@@ -269,6 +269,51 @@ struct OperatorOverloadCacheKey
     }
 };
 
+/// Key for caching the resolution of an ordinary call to an overloaded core module function.
+///
+/// Only calls of the form `f(a, b, ...)`, where `f` names an overload set made up entirely
+/// of declarations from the core module (or the GLSL module, when it is loaded) and every
+/// argument has a scalar, vector or matrix type, can be encoded. The overload set is
+/// identified by its first declaration, which is shared by all sessions of a global session.
+///
+struct CallOverloadCacheKey
+{
+    static const Index kMaxArgCount = 4;
+
+    Decl* firstCandidateDecl = nullptr;
+    int32_t candidateCount = 0;
+    int32_t argCount = 0;
+    bool isGLSLMode = false;
+    BasicTypeKey args[kMaxArgCount];
+
+    bool operator==(const CallOverloadCacheKey& key) const
+    {
+        if (firstCandidateDecl != key.firstCandidateDecl ||
+            candidateCount != key.candidateCount || argCount != key.argCount ||
+            isGLSLMode != key.isGLSLMode)
+            return false;
+        for (Index i = 0; i < argCount; i++)
+        {
+            if (!(args[i] == key.args[i]))
+                return false;
+        }
+        return true;
+    }
+    HashCode getHashCode() const
+    {
+        HashCode hash = combineHash(
+            Slang::getHashCode(firstCandidateDecl),
+            (HashCode32)candidateCount,
+            (HashCode32)argCount,
+            (HashCode32)isGLSLMode);
+        for (Index i = 0; i < argCount; i++)
+            hash = combineHash(hash, (HashCode32)args[i].getRaw());
+        return hash;
+    }
+    /// Initialize the key from a call, returning false if the call can't be cached.
+    bool fromInvokeExpr(InvokeExpr* invokeExpr, ModuleDecl* glslModuleDecl);
+};
+
 struct OverloadCandidate
 {
     enum class Flavor
@@ -325,6 +370,7 @@ struct OverloadCandidate
     SubstitutionSet subst;
 };
 
+/// A cached overload resolution result, for an operator or a call to a core module function.
 struct ResolvedOperatorOverload
 {
     // The resolved decl.
@@ -343,12 +389,27 @@ struct ResolvedOperatorOverload
 struct TypeCheckingCache : public RefObject
 {
     Dictionary<OperatorOverloadCacheKey, ResolvedOperatorOverload> resolvedOperatorOverloadCache;
+    Dictionary<CallOverloadCacheKey, ResolvedOperatorOverload> resolvedCallOverloadCache;
     Dictionary<BasicTypeKeyPair, ConversionCost> conversionCostCache;
 
     // The version used to invalidate the cached declRefs in ResolvedOperatorOverload entries.
     int version = 0;
 };
 
+/// Counters for `TypeCheckingCache::resolvedCallOverloadCache`, reported by
+/// `-report-perf-benchmark`.
+struct CallOverloadCacheStats
+{
+    /// Number of calls whose resolution was found in the cache.
+    UInt64 hitCount = 0;
+
+    /// Number of calls that could be cached, but had to be resolved.
+    UInt64 missCount = 0;
+};
+
+/// Get the call overload cache counters for the current thread.
+CallOverloadCacheStats& getCallOverloadCacheStats();
+
 enum class CoercionSite
 {
     General,
@@ -2823,6 +2823,53 @@ String SemanticsVisitor::getCallSignatureString(OverloadResolveContext& context)
     return argsListBuilder.produceString();
 }
 
+bool CallOverloadCacheKey::fromInvokeExpr(InvokeExpr* invokeExpr, ModuleDecl* glslModuleDecl)
+{
+    auto overloadedExpr = as<OverloadedExpr>(invokeExpr->functionExpr);
+    if (!overloadedExpr || overloadedExpr->base)
+        return false;
+
+    argCount = int32_t(invokeExpr->arguments.getCount());
+    if (argCount > kMaxArgCount)
+        return false;
+    for (Index i = 0; i < argCount; i++)
+    {
+        auto arg = invokeExpr->arguments[i];
+        args[i] = makeBasicTypeKey(arg->type, arg);
+        if (args[i].getRaw() == BasicTypeKey::invalid().getRaw())
+            return false;
+    }
+
+    // Any candidate from outside the core modules (for example a user overload of `max`)
+    // could change the outcome, so such calls are never cached. Non-public candidates are
+    // excluded as well, since whether they are visible depends on the calling scope.
+    //
+    candidateCount = 0;
+    for (auto item : overloadedExpr->lookupResult2)
+    {
+        auto decl = item.declRef.getDecl();
+        if (item.breadcrumbs)
+            return false;
+        bool isFromGLSLModule = glslModuleDecl && getModuleDecl(decl) == glslModuleDecl;
+        if (!isFromCoreModule(decl) && !isFromGLSLModule)
+            return false;
+        if (getDeclVisibility(decl) != DeclVisibility::Public)
+            return false;
+        if (!firstCandidateDecl)
+            firstCandidateDecl = decl;
+        candidateCount++;
+    }
+    isGLSLMode = glslModuleDecl != nullptr;
+    return firstCandidateDecl != nullptr;
+}
+
+static thread_local CallOverloadCacheStats gCallOverloadCacheStats;
+
+CallOverloadCacheStats& getCallOverloadCacheStats()
+{
+    return gCallOverloadCacheStats;
+}
+
 Expr* SemanticsVisitor::ResolveInvoke(InvokeExpr* expr)
 {
     OverloadResolveContext context;
@@ -2852,11 +2899,32 @@ Expr* SemanticsVisitor::ResolveInvoke(InvokeExpr* expr)
     context.sourceScope = m_outerScope;
     context.baseExpr = GetBaseExpr(funcExpr);
 
-    // check if this is a core module operator call, if so we want to use cached results
-    // to speed up compilation
+    // check if this is a core module operator call, or a plain call to an overloaded
+    // core module function, if so we want to use cached results to speed up compilation
     bool shouldAddToCache = false;
     OperatorOverloadCacheKey key;
+    CallOverloadCacheKey callKey;
+    bool isCallKeyValid = false;
     TypeCheckingCache* typeCheckingCache = getLinkage()->getTypeCheckingCache();
+    auto useCachedCandidate = [&](ResolvedOperatorOverload const& candidate)
+    {
+        // We should only use the cached candidate if it is persistent direct declref
+        // created from GlobalSession's ASTBuilder, or it is created in the current
+        // Linkage.
+        if (candidate.cacheVersion == typeCheckingCache->version ||
+            findNextOuterGeneric(candidate.decl) == nullptr)
+        {
+            context.bestCandidateStorage = candidate.candidate;
+            context.bestCandidate = &context.bestCandidateStorage;
+        }
+        else
+        {
+            LookupResultItem overloadCandidate = {};
+            overloadCandidate.declRef = getOuterGenericOrSelf(candidate.decl);
+            AddDeclRefOverloadCandidates(overloadCandidate, context, 0);
+            shouldAddToCache = true;
+        }
+    };
     if (auto opExpr = as<OperatorExpr>(expr))
     {
         if (key.fromOperatorExpr(opExpr))
@@ -2864,28 +2932,24 @@ Expr* SemanticsVisitor::ResolveInvoke(InvokeExpr* expr)
             key.isGLSLMode = getShared()->glslModuleDecl != nullptr;
             ResolvedOperatorOverload candidate;
             if (typeCheckingCache->resolvedOperatorOverloadCache.tryGetValue(key, candidate))
-            {
-                // We should only use the cached candidate if it is persistent direct declref
-                // created from GlobalSession's ASTBuilder, or it is created in the current
-                // Linkage.
-                if (candidate.cacheVersion == typeCheckingCache->version ||
-                    findNextOuterGeneric(candidate.decl) == nullptr)
-                {
-                    context.bestCandidateStorage = candidate.candidate;
-                    context.bestCandidate = &context.bestCandidateStorage;
-                }
-                else
-                {
-                    LookupResultItem overloadCandidate = {};
-                    overloadCandidate.declRef = getOuterGenericOrSelf(candidate.decl);
-                    AddDeclRefOverloadCandidates(overloadCandidate, context, 0);
-                    shouldAddToCache = true;
-                }
-            }
+                useCachedCandidate(candidate);
             else
-            {
                 shouldAddToCache = true;
-            }
+        }
+    }
+    else if (callKey.fromInvokeExpr(expr, getShared()->glslModuleDecl))
+    {
+        isCallKeyValid = true;
+        ResolvedOperatorOverload candidate;
+        if (typeCheckingCache->resolvedCallOverloadCache.tryGetValue(callKey, candidate))
+        {
+            getCallOverloadCacheStats().hitCount++;
+            useCachedCandidate(candidate);
+        }
+        else
+        {
+            getCallOverloadCacheStats().missCount++;
+            shouldAddToCache = true;
         }
     }
 
@@ -3129,7 +3193,13 @@ Expr* SemanticsVisitor::ResolveInvoke(InvokeExpr* expr)
                 overloadResult.candidate = *context.bestCandidate;
                 overloadResult.decl = context.bestCandidate->item.declRef.getDecl();
                 overloadResult.cacheVersion = typeCheckingCache->version;
-                typeCheckingCache->resolvedOperatorOverloadCache[key] = overloadResult;
+                if (isCallKeyValid)
+                {
+                    if (context.bestCandidate->status == OverloadCandidate::Status::Applicable)
+                        typeCheckingCache->resolvedCallOverloadCache[callKey] = overloadResult;
+                }
+                else
+                    typeCheckingCache->resolvedOperatorOverloadCache[key] = overloadResult;
             }
         }
 
@@ -2,6 +2,7 @@
 #include "slang-code-gen.h"
 
 #include "../compiler-core/slang-slice-allocator.h"
+#include "../core/slang-string-util.h"
 #include "../core/slang-type-convert-util.h"
 #include "../core/slang-type-text-util.h"
 #include "slang-compiler.h"
@@ -350,6 +351,55 @@ static bool _isCPUHostTarget(CodeGenTarget target)
     return desc.style == ArtifactStyle::Host;
 }
 
+// Get the queue to run the downstream compilation of `options` on, or nullptr if it should be
+// compiled as part of code generation.
+static DownstreamCompileQueue* _getDownstreamCompileQueue(
+    CodeGenContext* context,
+    IDownstreamCompiler* compiler,
+    const DownstreamCompileOptions& options)
+{
+    auto endToEndReq = context->isEndToEndCompile();
+    auto compileQueue = endToEndReq ? endToEndReq->getDownstreamCompileQueue() : nullptr;
+    if (!compileQueue)
+    {
+        return nullptr;
+    }
+
+    // Intermediates (such as DXIL that is then disassembled), and products that are dumped, are
+    // used as soon as they have been produced.
+    if (context->getTargetFormat() != context->getFinalTargetFormat() ||
+        context->shouldDumpIntermediates())
+    {
+        return nullptr;
+    }
+
+    if (!DownstreamCompileQueue::canCompileOnThread(compiler))
+    {
+        return nullptr;
+    }
+
+    // A compiler in the process reads includes through `options.fileSystemExt`, which in a job is
+    // the OS file system rather than the linkage's. So only hand over source that includes nothing.
+    if (!compiler->isFileBased())
+    {
+        if (options.includePaths.count)
+        {
+            return nullptr;
+        }
+        for (IArtifact* sourceArtifact : options.sourceArtifacts)
+        {
+            ComPtr<ISlangBlob> sourceBlob;
+            if (SLANG_FAILED(sourceArtifact->loadBlob(ArtifactKeep::Yes, sourceBlob.writeRef())) ||
+                StringUtil::getSlice(sourceBlob).indexOf(toSlice("#include")) >= 0)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    return compileQueue;
+}
+
 SlangResult CodeGenContext::emitWithDownstreamForEntryPoints(ComPtr<IArtifact>& outArtifact)
 {
     outArtifact.setNull();
@@ -1015,28 +1065,70 @@ SlangResult CodeGenContext::emitWithDownstreamForEntryPoints(ComPtr<IArtifact>&
         options.enablePAQ = m_targetProfile.getVersion() >= ProfileVersion::DX_6_7;
     }
 
+    // If a cache directory is set for a precompiled prelude, and the emitted C++ starts with the
+    // prelude, let the downstream compiler build (or reuse) a precompiled header from it.
+    //
+    // The prelude is still left in the emitted source, so that it compiles as is; its include
+    // guard makes the second copy a no-op once the precompiled header has been included.
+    if (sourceLanguage == SourceLanguage::CPP && sourceArtifact && !isPassThroughEnabled())
+    {
+        const String cachePath = getTargetProgram()->getOptionSet().getStringOption(
+            CompilerOptionName::PrecompiledPreludeCachePath);
+        const String& prelude = session->getPreludeForLanguage(SourceLanguage::CPP);
+
+        ComPtr<ISlangBlob> sourceBlob;
+        if (cachePath.getLength() && prelude.getLength() &&
+            SLANG_SUCCEEDED(sourceArtifact->loadBlob(ArtifactKeep::Yes, sourceBlob.writeRef())) &&
+            StringUtil::getSlice(sourceBlob).startsWith(prelude.getUnownedSlice()))
+        {
+            options.precompiledHeaderSource = allocator.allocate(prelude);
+            options.precompiledHeaderCachePath = allocator.allocate(cachePath);
+        }
+    }
+
     // Compile
+    RefPtr<DownstreamCompileCache> compileCache;
+    const String compileCachePath = getTargetProgram()->getOptionSet().getStringOption(
+        CompilerOptionName::DownstreamCompileCachePath);
+    if (compileCachePath.getLength() && !isPassThroughEnabled())
+    {
+        // With pass-through the source can include files the cache knows nothing about, so only
+        // source Slang emitted (which is self contained) is cached.
+        compileCache = getSession()->getDownstreamCompileCache(compileCachePath);
+    }
+
+    // If the end-to-end request runs downstream compilations in the background, hand this one
+    // over, and return an artifact the product will be added to once it has finished. Code can
+    // then be generated for the remaining entry points and targets whilst it compiles.
+    if (auto compileQueue = _getDownstreamCompileQueue(this, compiler, options))
+    {
+        const bool isWholeProgram = getTargetProgram()->getOptionSet().getBoolOption(
+            CompilerOptionName::GenerateWholeProgram);
+
+        EndToEndCompileRequest::PendingDownstreamCompile pending;
+        pending.job = compileQueue->add(compiler, options, compileCache);
+        pending.artifact = ArtifactUtil::createArtifact(
+            ArtifactDescUtil::makeDescForCompileTarget(options.targetType));
+        pending.sourceArtifact = sourceArtifact;
+        pending.targetProgram = getTargetProgram();
+        pending.entryPointIndex = isWholeProgram ? -1 : getEntryPointIndices()[0];
+        isEndToEndCompile()->addPendingDownstreamCompile(pending);
+
+        outArtifact = pending.artifact;
+        return SLANG_OK;
+    }
+
     ComPtr<IArtifact> artifact;
     auto downstreamStartTime = std::chrono::high_resolution_clock::now();
-    SlangResult compileResult = compiler->compile(options, artifact.writeRef());
+    const SlangResult compileResult =
+        compileCache ? compileCache->compile(compiler, options, artifact.writeRef())
+                     : compiler->compile(options, artifact.writeRef());
     auto downstreamElapsedTime =
         (std::chrono::high_resolution_clock::now() - downstreamStartTime).count() * 0.000000001;
     getSession()->addDownstreamCompileTime(downstreamElapsedTime);
 
-    // Extract diagnostics regardless of compile result
-    SLANG_RETURN_ON_FAIL(passthroughDownstreamDiagnostics(getSink(), compiler, artifact));
-
-    // Now check if compile failed
-    SLANG_RETURN_ON_FAIL(compileResult);
-
-    // Copy over all of the information associated with the source into the output
-    if (sourceArtifact)
-    {
-        for (auto associatedArtifact : sourceArtifact->getAssociated())
-        {
-            artifact->addAssociated(associatedArtifact);
-        }
-    }
+    SLANG_RETURN_ON_FAIL(
+        finishDownstreamCompile(getSink(), compiler, compileResult, sourceArtifact, artifact));
 
     // Set the artifact
     outArtifact.swap(artifact);
@@ -1395,6 +1487,12 @@ bool CodeGenContext::shouldReportDynamicDispatchSites()
         CompilerOptionName::ReportDynamicDispatchSites);
 }
 
+bool CodeGenContext::shouldSpecializeWithFullSweeps()
+{
+    return getTargetProgram()->getOptionSet().getBoolOption(
+        CompilerOptionName::SpecializeFullSweep);
+}
+
 bool CodeGenContext::shouldDumpIntermediates()
 {
     return getTargetProgram()->getOptionSet().getBoolOption(CompilerOptionName::DumpIntermediates);
@@ -175,6 +175,7 @@ public:
     bool shouldDumpIR();
     bool shouldReportCheckpointIntermediates();
     bool shouldReportDynamicDispatchSites();
+    bool shouldSpecializeWithFullSweeps();
 
     bool shouldTrackLiveness();
 
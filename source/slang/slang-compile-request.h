@@ -134,6 +134,13 @@ public:
     // If true will serialize and de-serialize with debug information
     bool verifyDebugSerialization = false;
 
+    // If true, `-lazy-function-body-checking` may skip functions in these translation units.
+    //
+    // Only end-to-end requests set this. Their entry points are either requested or marked with
+    // an attribute before checking, while a module loaded through `ISession` can have any of its
+    // functions named as an entry point afterwards (`findEntryPointByName`).
+    bool allowLazyFunctionBodySkipping = false;
+
     CompilerOptionSet optionSet;
 
     List<RefPtr<FrontEndEntryPointRequest>> m_entryPointReqs;
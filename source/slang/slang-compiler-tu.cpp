@@ -178,6 +178,12 @@ Module::precompileForTarget(SlangCompileTarget target, slang::IBlob** outDiagnos
         return SLANG_OK;
     }
 
+    // The linker caches which global insts are exported, and the export decorations added
+    // above (and removed again below) change that, so the cached information must be
+    // discarded both before linking and once the module has been updated.
+    module->invalidateLinkInfo();
+    SLANG_DEFER(module->invalidateLinkInfo());
+
     ComPtr<IArtifact> outArtifact;
     SlangResult res = codeGenContext.emitPrecompiledDownstreamIR(outArtifact);
 
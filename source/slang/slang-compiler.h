@@ -206,6 +206,15 @@ SlangResult passthroughDownstreamDiagnostics(
     IDownstreamCompiler* compiler,
     IArtifact* artifact);
 
+/// Report the diagnostics from compiling `sourceArtifact` into `artifact` with `compiler`.
+/// If the compilation succeeded, the artifacts associated with the source are added to `artifact`.
+SlangResult finishDownstreamCompile(
+    DiagnosticSink* sink,
+    IDownstreamCompiler* compiler,
+    SlangResult compileResult,
+    IArtifact* sourceArtifact,
+    IArtifact* artifact);
+
 
 // helpers for error/warning reporting
 enum class DiagnosticCategory
@@ -0,0 +1,238 @@
+// slang-decl-cost-report.cpp
+#include "slang-decl-cost-report.h"
+
+#include "../core/slang-string-util.h"
+#include "slang-ast-print.h"
+#include "slang-ir-insts.h"
+#include "slang-ir.h"
+
+namespace Slang
+{
+
+Index DeclCostReport::_getEntryIndex(Decl* decl)
+{
+    // A generic is reported as the declaration it wraps.
+    if (auto genericDecl = as<GenericDecl>(decl))
+        decl = genericDecl->inner;
+
+    if (auto indexPtr = m_entryIndexMap.tryGetValue(decl))
+        return *indexPtr;
+
+    DeclEntry entry;
+    {
+        ASTPrinter printer(m_astBuilder);
+        printer.addDeclPath(makeDeclRef(decl));
+        entry.name = printer.getString();
+    }
+    if (m_sourceManager && decl->loc.isValid())
+    {
+        const auto humaneLoc = m_sourceManager->getHumaneLoc(decl->loc);
+
+        StringBuilder location;
+        location << humaneLoc.pathInfo.getName() << "(" << humaneLoc.line << ")";
+        entry.location = location.produceString();
+    }
+
+    const Index index = m_entries.getCount();
+    m_entries.add(entry);
+    m_entryIndexMap.add(decl, index);
+
+    // Remember the extent of the body, so that IR instructions can be traced back to it.
+    if (auto funcDecl = as<FunctionDeclBase>(decl))
+    {
+        auto body = as<BlockStmt>(funcDecl->body);
+        if (body && decl->loc.isValid() && body->closingSourceLoc.isValid() &&
+            decl->loc.getRaw() <= body->closingSourceLoc.getRaw())
+        {
+            BodyRange range;
+            range.begin = decl->loc.getRaw();
+            range.end = body->closingSourceLoc.getRaw();
+            range.entryIndex = index;
+            m_bodyRanges.add(range);
+            m_bodyRangesSorted = false;
+        }
+    }
+
+    return index;
+}
+
+void DeclCostReport::_sortBodyRanges()
+{
+    // Outer ranges sort before the ranges nested in them.
+    m_bodyRanges.sort(
+        [](const BodyRange& a, const BodyRange& b)
+        { return a.begin < b.begin || (a.begin == b.begin && a.end > b.end); });
+
+    // Bodies can nest (such as a lambda in a function), but don't otherwise overlap, so the
+    // ranges that contain the one being visited are on the stack.
+    List<Index> stack;
+    for (Index i = 0; i < m_bodyRanges.getCount(); ++i)
+    {
+        auto& range = m_bodyRanges[i];
+        while (stack.getCount() && m_bodyRanges[stack.getLast()].end < range.begin)
+            stack.removeLast();
+        range.parentIndex = stack.getCount() ? stack.getLast() : -1;
+        stack.add(i);
+    }
+    m_bodyRangesSorted = true;
+}
+
+Index DeclCostReport::_findEntryIndex(SourceLoc loc)
+{
+    if (!loc.isValid() || m_bodyRanges.getCount() == 0)
+        return -1;
+
+    if (!m_bodyRangesSorted)
+        _sortBodyRanges();
+
+    // Find the first range that starts after `loc`.
+    const auto raw = loc.getRaw();
+    Index lo = 0;
+    Index hi = m_bodyRanges.getCount();
+    while (lo < hi)
+    {
+        const Index mid = (lo + hi) / 2;
+        if (m_bodyRanges[mid].begin <= raw)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    // Any body containing `loc` contains the last one that starts before it too (or is that
+    // one), so the innermost is found by walking out from there.
+    for (Index i = lo - 1; i >= 0; i = m_bodyRanges[i].parentIndex)
+    {
+        if (m_bodyRanges[i].end >= raw)
+            return m_bodyRanges[i].entryIndex;
+    }
+    return -1;
+}
+
+void DeclCostReport::addLoweringTime(Decl* decl, double seconds)
+{
+    m_entries[_getEntryIndex(decl)].loweringTime += seconds;
+}
+
+static String _getFuncName(IRInst* func)
+{
+    if (auto nameHint = func->findDecoration<IRNameHintDecoration>())
+        return nameHint->getName();
+    if (auto linkage = func->findDecoration<IRLinkageDecoration>())
+        return linkage->getMangledName();
+    return "(unnamed)";
+}
+
+void DeclCostReport::addFinalIR(IRModule* module)
+{
+    List<IRInst*> workList;
+    for (auto globalInst : module->getGlobalInsts())
+    {
+        auto func = as<IRGlobalValueWithCode>(globalInst);
+        if (!func || !func->getFirstBlock())
+            continue;
+
+        // Instructions without a location of their own (or outside of any body that was lowered
+        // in this session) are charged to the declaration of the function they are in.
+        const Index funcEntryIndex = _findEntryIndex(func->sourceLoc);
+        Count funcInstCount = 0;
+
+        workList.add(func);
+        while (workList.getCount())
+        {
+            auto inst = workList.getLast();
+            workList.removeLast();
+
+            for (auto child : inst->getChildren())
+            {
+                ++funcInstCount;
+
+                Index entryIndex = _findEntryIndex(child->sourceLoc);
+                if (entryIndex < 0)
+                    entryIndex = funcEntryIndex;
+
+                if (entryIndex >= 0)
+                    m_entries[entryIndex].instCount++;
+                else
+                    m_unattributedInstCount++;
+
+                workList.add(child);
+            }
+        }
+
+        auto& funcEntry = m_funcEntries.getOrAddValue(_getFuncName(func), FuncEntry());
+        funcEntry.instanceCount++;
+        funcEntry.instCount += funcInstCount;
+    }
+}
+
+void DeclCostReport::writeReport(StringBuilder& out, Count maxEntryCount)
+{
+    List<Index> order;
+    for (Index i = 0; i < m_entries.getCount(); ++i)
+        order.add(i);
+
+    auto writeDecl = [&](const DeclEntry& entry)
+    {
+        out << "  " << entry.name;
+        if (entry.location.getLength())
+            out << "  " << entry.location;
+        out << "\n";
+    };
+
+    out << "Time lowering to IR, not counting declarations lowered on demand (ms):\n";
+    order.sort([&](Index a, Index b)
+               { return m_entries[a].loweringTime > m_entries[b].loweringTime; });
+    for (Index i = 0; i < order.getCount() && i < maxEntryCount; ++i)
+    {
+        const auto& entry = m_entries[order[i]];
+        if (entry.loweringTime <= 0.0)
+            break;
+        StringUtil::appendFormat(out, "  %10.3f", entry.loweringTime * 1000.0);
+        writeDecl(entry);
+    }
+
+    out << "IR instructions in generated code, by source declaration:\n";
+    order.sort([&](Index a, Index b) { return m_entries[a].instCount > m_entries[b].instCount; });
+    for (Index i = 0; i < order.getCount() && i < maxEntryCount; ++i)
+    {
+        const auto& entry = m_entries[order[i]];
+        if (entry.instCount == 0)
+            break;
+        StringUtil::appendFormat(out, "  %10lld", (long long)entry.instCount);
+        writeDecl(entry);
+    }
+    if (m_unattributedInstCount)
+    {
+        StringUtil::appendFormat(out, "  %10lld", (long long)m_unattributedInstCount);
+        out << "  (not traced to a declaration)\n";
+    }
+
+    out << "IR instructions in generated code, by function:\n";
+    List<String> funcNames;
+    for (const auto& [name, funcEntry] : m_funcEntries)
+        funcNames.add(name);
+    funcNames.sort([&](const String& a, const String& b)
+                   { return m_funcEntries[a].instCount > m_funcEntries[b].instCount; });
+    for (Index i = 0; i < funcNames.getCount() && i < maxEntryCount; ++i)
+    {
+        const auto& funcEntry = m_funcEntries[funcNames[i]];
+        StringUtil::appendFormat(out, "  %10lld", (long long)funcEntry.instCount);
+        out << "  " << funcNames[i];
+        if (funcEntry.instanceCount > 1)
+            out << "  (" << funcEntry.instanceCount << " instances)";
+        out << "\n";
+    }
+}
+
+void DeclCostReport::resetCosts()
+{
+    for (auto& entry : m_entries)
+    {
+        entry.loweringTime = 0.0;
+        entry.instCount = 0;
+    }
+    m_funcEntries.clear();
+    m_unattributedInstCount = 0;
+}
+
+} // namespace Slang
@@ -0,0 +1,114 @@
+// slang-decl-cost-report.h
+#pragma once
+
+//
+// This file defines `DeclCostReport`, which accumulates the
+// compile time cost of source declarations for the
+// `-report-decl-costs` option.
+//
+
+#include "../compiler-core/slang-source-loc.h"
+#include "../core/slang-basic.h"
+
+namespace Slang
+{
+class ASTBuilder;
+class Decl;
+struct IRModule;
+
+/// Accumulates what source declarations cost to compile.
+///
+/// Two costs are recorded for each declaration:
+///
+/// * The time spent lowering it to IR. This is "self" time: lowering
+///   a declaration lowers the declarations it refers to on demand,
+///   and that time is charged to them rather than to it.
+///
+/// * The number of IR instructions it accounts for in the IR that
+///   code is generated from, after linking, specialization and
+///   inlining. Instructions are charged to the declaration whose
+///   body their source location is in, so code that an inlined
+///   function (or a generic) contributes to its callers is charged
+///   to that function.
+///
+/// The functions in the final IR are also counted as they are, so
+/// that each specialization of a generic shows up separately.
+///
+/// Costs are summed over every module, target and entry point
+/// compiled with the linkage, until they are reset with
+/// `resetCosts`.
+///
+class DeclCostReport : public RefObject
+{
+public:
+    DeclCostReport(SourceManager* sourceManager, ASTBuilder* astBuilder)
+        : m_sourceManager(sourceManager), m_astBuilder(astBuilder)
+    {
+    }
+
+    /// Record that lowering `decl` to IR took `seconds`, not counting
+    /// the declarations that were lowered on demand along the way.
+    void addLoweringTime(Decl* decl, double seconds);
+
+    /// Count the instructions in `module`, which should be IR that code
+    /// is about to be generated from.
+    void addFinalIR(IRModule* module);
+
+    /// Write the report, listing at most `maxEntryCount` items in each section.
+    void writeReport(StringBuilder& out, Count maxEntryCount);
+
+    /// Reset the costs to zero, so that the report covers only what is
+    /// compiled from now on.
+    ///
+    /// The declarations and their body ranges are kept: a module that
+    /// has already been lowered is not lowered again, so its IR can only
+    /// be traced back to its declarations through them.
+    void resetCosts();
+
+protected:
+    struct DeclEntry
+    {
+        String name;
+        String location;
+        double loweringTime = 0.0;
+        Count instCount = 0;
+    };
+
+    struct FuncEntry
+    {
+        Count instanceCount = 0;
+        Count instCount = 0;
+    };
+
+    /// The range of source a declaration's body covers
+    struct BodyRange
+    {
+        SourceLoc::RawValue begin;
+        SourceLoc::RawValue end;
+        Index entryIndex;
+        /// The closest range that contains this one (in `m_bodyRanges`), or -1
+        Index parentIndex = -1;
+    };
+
+    Index _getEntryIndex(Decl* decl);
+    /// Sort `m_bodyRanges`, and link each one to the range it is nested in.
+    void _sortBodyRanges();
+    /// Find the entry for the declaration whose body contains `loc`, or -1.
+    Index _findEntryIndex(SourceLoc loc);
+
+    SourceManager* m_sourceManager;
+    ASTBuilder* m_astBuilder;
+
+    List<DeclEntry> m_entries;
+    Dictionary<Decl*, Index> m_entryIndexMap;
+
+    List<BodyRange> m_bodyRanges;
+    bool m_bodyRangesSorted = true;
+
+    /// Final IR functions, by the name they would be emitted with
+    Dictionary<String, FuncEntry> m_funcEntries;
+    /// Final IR instructions that can't be traced to a declaration
+    Count m_unattributedInstCount = 0;
+};
+
+} // namespace Slang
@@ -391,6 +391,8 @@ err(
 
 err("null-component-type", 105, "componentTypes[~index:Int] is `nullptr`")
 
+standalone_note("declaration-cost-report", 106, "compile time cost by declaration:\\n~report")
+
 standalone_note("note-failed-to-load-dynamic-library", 99999, "failed to load dynamic library '~path'")
 
 --
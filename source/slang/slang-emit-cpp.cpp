@@ -2110,22 +2110,43 @@ void CPPSourceEmitter::_emitEntryPointGroup(
     for (Index i = 0; i < axes.getCount(); ++i)
     {
         const auto& axis = axes[i];
+        const bool isInnermost = (i == axes.getCount() - 1);
         builder.clear();
         const char elem[2] = {s_xyzwNames[axis.axis], 0};
+
+        // The innermost loop is the one that maps consecutive threads onto SIMD lanes
+        // if the downstream compiler decides to vectorize. This relies on a suitable
+        // definition in slang-cpp-prelude.h or defined in C++ compiler invocation.
+        if (isInnermost)
+        {
+            builder << "SLANG_VECTORIZE_LOOP\n";
+        }
         builder << "for (uint32_t " << elem << " = 0; " << elem << " < " << axis.size << "; ++"
                 << elem << ")\n{\n";
         m_writer->emit(builder);
         m_writer->indent();
 
         builder.clear();
-        builder << "threadInput.groupThreadID." << elem << " = " << elem << ";\n";
+        if (isInnermost)
+        {
+            // Each iteration of the innermost loop works on its own copy of the varying
+            // input, so there is no loop carried dependency through `threadInput`.
+            builder << "ComputeThreadVaryingInput laneInput = threadInput;\n";
+            builder << "laneInput.groupThreadID." << elem << " = " << elem << ";\n";
+        }
+        else
+        {
+            builder << "threadInput.groupThreadID." << elem << " = " << elem << ";\n";
+        }
         m_writer->emit(builder);
     }
 
     // just call at inner loop point
     m_writer->emit("_");
     m_writer->emit(funcName);
-    m_writer->emit("(&threadInput, entryPointParams, globalParams);\n");
+    m_writer->emit(
+        axes.getCount() ? "(&laneInput, entryPointParams, globalParams);\n"
+                        : "(&threadInput, entryPointParams, globalParams);\n");
 
     // Close all the loops
     for (Index i = Index(axes.getCount() - 1); i >= 0; --i)
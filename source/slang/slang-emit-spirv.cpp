@@ -135,8 +135,13 @@ public:
     /// Add an instruction to the end of the list of children
     void addInst(SpvInst* inst);
 
-    /// Dump all children, recursively, to a flattened list of SPIR-V words
-    void dumpTo(List<SpvWord>& ioWords);
+    /// Dump all children, recursively, to a flattened array of SPIR-V words
+    ///
+    /// `ioCursor` must have room for `getWordCount()` words, and is advanced past them.
+    void dumpTo(SpvWord*& ioCursor);
+
+    /// Count the words that `dumpTo` will write for all children, recursively
+    Count getWordCount() const;
 
     /// The first child, if any.
     SpvInst* m_firstChild = nullptr;
@@ -211,7 +216,7 @@ struct SpvInst : SpvInstParent
     SpvWord id = 0;
 
     /// Dump the instruction (and any children, recursively) into the flat array of SPIR-V words.
-    void dumpTo(List<SpvWord>& ioWords)
+    void dumpTo(SpvWord*& ioCursor)
     {
         // [2.2: Terms]
         //
@@ -226,11 +231,15 @@ struct SpvInst : SpvInstParent
         // > Opcode: The 16 high-order bits are the WordCount of the instruction.
         // >         The 16 low-order bits are the opcode enumerant.
         //
-        ioWords.add(wordCount << 16 | opcode);
+        *ioCursor++ = wordCount << 16 | opcode;
 
         // The operand words simply follow the opcode word.
         //
-        ioWords.addRange(operandWords, operandWordsCount);
+        if (operandWordsCount)
+        {
+            memcpy(ioCursor, operandWords, operandWordsCount * sizeof(SpvWord));
+            ioCursor += operandWordsCount;
+        }
 
         // In our representation choice, the children of a
         // parent instruction will always follow the encoded
@@ -239,7 +248,13 @@ struct SpvInst : SpvInstParent
         // * The instructions inside a function always follow the `OpFunction`
         // * The instructions inside a block always follow the `OpLabel`
         //
-        SpvInstParent::dumpTo(ioWords);
+        SpvInstParent::dumpTo(ioCursor);
+    }
+
+    /// Count the words that `dumpTo` will write for this instruction and its children.
+    Count getWordCount() const
+    {
+        return 1 + Count(operandWordsCount) + SpvInstParent::getWordCount();
     }
 
     void removeFromParent()
@@ -309,14 +324,24 @@ void SpvInstParent::addInst(SpvInst* inst)
     m_lastChild = inst;
 }
 
-void SpvInstParent::dumpTo(List<SpvWord>& ioWords)
+void SpvInstParent::dumpTo(SpvWord*& ioCursor)
 {
     for (auto child = m_firstChild; child; child = child->nextSibling)
     {
-        child->dumpTo(ioWords);
+        child->dumpTo(ioCursor);
     }
 }
 
+Count SpvInstParent::getWordCount() const
+{
+    Count wordCount = 0;
+    for (auto child = m_firstChild; child; child = child->nextSibling)
+    {
+        wordCount += child->getWordCount();
+    }
+    return wordCount;
+}
+
 /// The context for inlining a SPV assembly snippet.
 struct SpvSnippetEmitContext
 {
@@ -515,29 +540,46 @@ struct SPIRVEmitContext : public SourceEmitterBase, public SPIRVEmitSharedContex
     // At the end of emission we need a single linear stream of words,
     // so we will eventually flatten `m_sections` into a single array.
 
-    /// The final array of SPIR-V words that defines the encoded module
-    List<SpvWord> m_words;
-
     /// Emit the concrete words that make up the binary SPIR-V module.
     ///
-    /// This function fills in `m_words` based on the data in `m_sections`.
-    /// This function should only be called once.
+    /// This function appends the encoded module, based on the data in
+    /// `m_sections`, to `ioBytes`. It should only be called once.
     ///
-    void emitPhysicalLayout()
-    {
+    void emitPhysicalLayout(List<uint8_t>& ioBytes)
+    {
+        // Function bodies and the global sections are built up as separate
+        // lists of instructions, and this is where they are stitched together.
+        // For large shaders the flattened module can run to millions of words,
+        // so we size the output once up front and write the words straight
+        // into it, rather than flattening into an intermediate word list
+        // that then has to be copied.
+        //
+        const Count kHeaderWordCount = 5;
+        Count wordCount = kHeaderWordCount;
+        for (int ii = 0; ii < int(SpvLogicalSectionID::Count); ++ii)
+        {
+            wordCount += m_sections[ii].getWordCount();
+        }
+
+        const Index startByteCount = ioBytes.getCount();
+        ioBytes.setCount(startByteCount + wordCount * Index(sizeof(SpvWord)));
+
+        SpvWord* cursor = reinterpret_cast<SpvWord*>(ioBytes.getBuffer() + startByteCount);
+        SpvWord* const end = cursor + wordCount;
+
         // [2.3: Physical Layout of a SPIR-V Module and Instruction]
         //
         // > Magic Number
         //
-        m_words.add(SpvMagicNumber);
+        *cursor++ = SpvMagicNumber;
 
         // > Version nuumber
         //
-        m_words.add(m_spvVersion);
+        *cursor++ = m_spvVersion;
 
         // > Generator's magic number.
         //
-        m_words.add(kSPIRVSlangCompilerId);
+        *cursor++ = kSPIRVSlangCompilerId;
 
         // > Bound
         //
@@ -545,11 +587,11 @@ struct SPIRVEmitContext : public SourceEmitterBase, public SPIRVEmitSharedContex
         // <id>s, so its value when we are done emitting code
         // can serve as the bound.
         //
-        m_words.add(m_nextID);
+        *cursor++ = m_nextID;
 
         // > 0 (Reserved for instruction schema, if needed.)
         //
-        m_words.add(0);
+        *cursor++ = 0;
 
         // > First word of instruction stream
         // > All remaining words are a linear sequence of instructions.
@@ -559,8 +601,10 @@ struct SPIRVEmitContext : public SourceEmitterBase, public SPIRVEmitSharedContex
         //
         for (int ii = 0; ii < int(SpvLogicalSectionID::Count); ++ii)
         {
-            m_sections[ii].dumpTo(m_words);
+            m_sections[ii].dumpTo(cursor);
         }
+        SLANG_ASSERT(cursor == end);
+        SLANG_UNUSED(end);
     }
 
     // We will often need to refer to an instrcition by its
@@ -10756,11 +10800,7 @@ SlangResult emitSPIRVFromIR(
 
     context.emitFrontMatter();
 
-    context.emitPhysicalLayout();
-
-    spirvOut.addRange(
-        (uint8_t const*)context.m_words.getBuffer(),
-        context.m_words.getCount() * Index(sizeof(context.m_words[0])));
+    context.emitPhysicalLayout(spirvOut);
 
     return SLANG_OK;
 }
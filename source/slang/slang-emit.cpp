@@ -982,6 +982,7 @@ Result linkAndOptimizeIR(
             specOptions.lowerWitnessLookups = false;
             specOptions.reportDynamicDispatchSites =
                 codeGenContext->shouldReportDynamicDispatchSites();
+            specOptions.fullSweep = codeGenContext->shouldSpecializeWithFullSweeps();
             changed |=
                 SLANG_PASS(specializeModule, targetProgram, codeGenContext->getSink(), specOptions);
         }
@@ -1056,6 +1057,7 @@ Result linkAndOptimizeIR(
         SpecializationOptions specOptions;
         specOptions.lowerWitnessLookups = true;
         specOptions.reportDynamicDispatchSites = codeGenContext->shouldReportDynamicDispatchSites();
+        specOptions.fullSweep = codeGenContext->shouldSpecializeWithFullSweeps();
         SLANG_PASS(specializeModule, targetProgram, codeGenContext->getSink(), specOptions);
     }
 
@@ -2061,6 +2063,9 @@ Result linkAndOptimizeIR(
         validateIRModuleIfEnabled(codeGenContext, irModule);
     }
 
+    if (auto declCostReport = codeGenContext->getLinkage()->getDeclCostReport())
+        declCostReport->addFinalIR(irModule);
+
     auto metadata = new ArtifactPostEmitMetadata;
     outLinkedIR.metadata = metadata;
 
@@ -2300,7 +2305,9 @@ SlangResult CodeGenContext::emitEntryPointsSourceFromIR(ComPtr<IArtifact>& outAr
     // By getting in this way, the content is no longer referenced by the sourceWriter.
     String finalResult = sourceWriter.getContentAndClear();
 
-    // Append the modules output code
+    // Append the modules output code. The generated code is usually much
+    // larger than the front matter, so make room for it in one step.
+    finalResult.ensureCapacity(finalResult.getLength() + code.getLength());
     finalResult.append(code);
 
     finalResult.append(sourceWriter.getContentAndClear());
@@ -7,8 +7,11 @@
 #include "slang-check-impl.h"
 #include "slang-compiler.h"
 #include "slang-emit-dependency-file.h"
+#include "slang-ir-specialize.h"
+#include "slang-lookup.h"
 #include "slang-module-library.h"
 #include "slang-options.h"
+#include "slang-reflection-binary.h"
 #include "slang-reflection-json.h"
 #include "slang-repro.h"
 #include "slang-rich-diagnostics.h"
@@ -55,6 +58,7 @@ void EndToEndCompileRequest::init()
     }
 
     m_frontEndReq = new FrontEndCompileRequest(getLinkage(), m_writers, getSink());
+    m_frontEndReq->allowLazyFunctionBodySkipping = true;
 }
 
 EndToEndCompileRequest::~EndToEndCompileRequest()
@@ -710,6 +714,17 @@ void EndToEndCompileRequest::generateOutput(ComponentType* program)
     }
 
 
+    // If more than one downstream job is allowed, downstream compilations
+    // run in the background whilst code is generated for the remaining
+    // entry points and targets, and are finished once all of it has been.
+    //
+    const int downstreamJobCount =
+        getOptionSet().getIntOption(CompilerOptionName::DownstreamJobCount);
+    if (downstreamJobCount > 1)
+    {
+        m_downstreamCompileQueue = new DownstreamCompileQueue(downstreamJobCount);
+    }
+
     // Go through the code-generation targets that the user
     // has specified, and generate code for each of them.
     //
@@ -722,6 +737,57 @@ void EndToEndCompileRequest::generateOutput(ComponentType* program)
         auto targetProgram = program->getTargetProgram(targetReq);
         generateOutput(targetProgram);
     }
+
+    _finishPendingDownstreamCompiles();
+}
+
+void EndToEndCompileRequest::_finishPendingDownstreamCompiles()
+{
+    if (!m_downstreamCompileQueue)
+        return;
+
+    m_downstreamCompileQueue->wait();
+
+    // The results are reported in the order the compilations were started.
+    // Downstream diagnostics for each of them are in the same order as they
+    // would be without the queue, but now come after all of the diagnostics
+    // Slang reported while generating code, rather than interleaved with them.
+    //
+    for (auto& pending : m_pendingDownstreamCompiles)
+    {
+        auto job = pending.job;
+        IArtifact* artifact = job->getArtifact();
+
+        getSession()->addDownstreamCompileTime(job->getElapsedTime());
+
+        if (SLANG_FAILED(finishDownstreamCompile(
+                getSink(),
+                job->getCompiler(),
+                job->getResult(),
+                pending.sourceArtifact,
+                artifact)))
+        {
+            pending.targetProgram->_discardResult(pending.entryPointIndex);
+            continue;
+        }
+
+        // Move the product into the artifact that stood in for it.
+        if (auto name = artifact->getName())
+        {
+            pending.artifact->setName(name);
+        }
+        for (auto representation : artifact->getRepresentations())
+        {
+            pending.artifact->addRepresentation(representation);
+        }
+        for (auto associated : artifact->getAssociated())
+        {
+            pending.artifact->addAssociated(associated);
+        }
+    }
+
+    m_pendingDownstreamCompiles.clear();
+    m_downstreamCompileQueue = nullptr;
 }
 
 void EndToEndCompileRequest::generateOutput()
@@ -1456,6 +1522,12 @@ SlangResult EndToEndCompileRequest::compile()
     double downstreamStartTime = 0.0;
     double totalStartTime = 0.0;
 
+    // The per-thread counters printed by `-report-perf-benchmark` cover this compile only.
+    getIRAnalysisStats() = IRAnalysisStats();
+    getSpecializationStats() = SpecializationStats();
+    getScopedLookupStats() = ScopedLookupStats();
+    getCallOverloadCacheStats() = CallOverloadCacheStats();
+
     if (getOptionSet().getBoolOption(CompilerOptionName::ReportDownstreamTime))
     {
         getSession()->getCompilerElapsedTime(&totalStartTime, &downstreamStartTime);
@@ -1533,9 +1605,75 @@ SlangResult EndToEndCompileRequest::compile()
         StringBuilder perfResult;
         PerformanceProfiler::getProfiler()->getResult(perfResult);
         perfResult << "\nType Dictionary Size: " << getSession()->m_typeDictionarySize << "\n";
+        perfResult << "Core Conversion Cost Table: "
+                   << getSession()->m_coreConversionCostTableEntryCount << " entries\n";
+        if (auto arenaPool = getSession()->getIRMemoryArenaPool())
+        {
+            auto stats = arenaPool->getStats();
+            perfResult << "IR Arena Pool: " << UInt64(stats.acquireCount) << " acquired, "
+                       << UInt64(stats.reuseCount) << " reused, " << UInt64(stats.discardCount)
+                       << " discarded, " << UInt64(stats.blockPayloadSize) << " byte blocks, "
+                       << UInt64(stats.pooledBytes) << " bytes pooled\n";
+        }
+        {
+            auto& stats = getScopedLookupStats();
+            perfResult << "Scoped Lookup: " << stats.lookupCount << " lookups, "
+                       << stats.containerCount << " containers visited, "
+                       << stats.skippedContainerCount << " skipped\n";
+        }
+        {
+            auto& stats = getCallOverloadCacheStats();
+            perfResult << "Call Overload Cache: " << stats.hitCount << " hits, "
+                       << stats.missCount << " misses\n";
+        }
+        {
+            auto& stats = getIRAnalysisStats();
+            perfResult << "IR Dominator Tree Cache: " << stats.dominatorTreeHitCount << " hits, "
+                       << stats.dominatorTreeMissCount << " misses\n";
+        }
+        {
+            auto& stats = getSpecializationStats();
+            perfResult << "Specialization: " << stats.sweepCount << " sweeps ("
+                       << stats.fullSweepCount << " full), " << stats.visitedInstCount
+                       << " insts visited (" << stats.incrementalVisitedInstCount
+                       << " by incremental sweeps)\n";
+        }
+        DownstreamCompileCache::Stats compileCacheStats;
+        if (getSession()->getDownstreamCompileCacheStats(compileCacheStats))
+        {
+            perfResult << "Downstream Compile Cache: " << UInt64(compileCacheStats.hitCount)
+                       << " hits, " << UInt64(compileCacheStats.missCount) << " misses, "
+                       << UInt64(compileCacheStats.entryCount) << " entries\n";
+        }
+        // The JIT object cache is process wide, and only exists once slang-llvm is loaded.
+        if (auto slangLLVM = getSession()->m_slangLLVM.get())
+        {
+            using StatsFuncV1 = SlangResult (*)(
+                uint64_t* outHitCount,
+                uint64_t* outMissCount,
+                uint64_t* outEntryCount,
+                uint64_t* outEntryByteCount);
+            auto statsFunc =
+                (StatsFuncV1)slangLLVM->findFuncByName("getLLVMJITObjectCacheStats_V1");
+            uint64_t hitCount = 0, missCount = 0, entryCount = 0, entryByteCount = 0;
+            if (statsFunc &&
+                SLANG_SUCCEEDED(statsFunc(&hitCount, &missCount, &entryCount, &entryByteCount)))
+            {
+                perfResult << "LLVM JIT Object Cache: " << hitCount << " hits, " << missCount
+                           << " misses, " << entryCount << " entries, " << entryByteCount
+                           << " bytes\n";
+            }
+        }
         getSink()->diagnose(
             Diagnostics::PerformanceBenchmarkResult{.benchmarkOutput = perfResult.produceString()});
     }
+    // The report only covers this request, as the linkage can be used for more than one.
+    {
+        StringBuilder report;
+        if (getLinkage()->takeDeclCostReport(report, 20))
+            getSink()->diagnose(
+                Diagnostics::DeclarationCostReport{.report = report.produceString()});
+    }
 
     // Repro dump handling
     {
@@ -1591,6 +1729,29 @@ SlangResult EndToEndCompileRequest::compile()
         }
     }
 
+    auto binaryReflectionPath =
+        getOptionSet().getStringOption(CompilerOptionName::EmitReflectionBinary);
+    if (binaryReflectionPath.getLength() != 0)
+    {
+        auto reflection = this->getReflection();
+        if (!reflection)
+        {
+            getSink()->diagnose(Diagnostics::CannotEmitReflectionWithoutTarget{});
+            return SLANG_FAIL;
+        }
+        ComPtr<ISlangBlob> blob;
+        SLANG_RETURN_ON_FAIL(
+            writeBinaryReflection((slang::ProgramLayout*)reflection, blob.writeRef()));
+        if (SLANG_FAILED(File::writeAllBytes(
+                binaryReflectionPath,
+                blob->getBufferPointer(),
+                blob->getBufferSize())))
+        {
+            getSink()->diagnose(
+                Diagnostics::UnableToWriteFile{.path = String(binaryReflectionPath)});
+        }
+    }
+
     return res;
 }
 
@@ -21,6 +21,7 @@
 // the public API.
 //
 
+#include "../compiler-core/slang-downstream-compile-queue.h"
 #include "../compiler-core/slang-source-embed-util.h"
 #include "../core/slang-file-system.h"
 #include "slang-compile-request.h"
@@ -380,6 +381,32 @@ public:
 
     CompilerOptionSet& getOptionSet() { return m_linkage->m_optionSet; }
 
+    /// A downstream compilation that code generation started on the downstream compile queue.
+    struct PendingDownstreamCompile
+    {
+        RefPtr<DownstreamCompileQueue::Job> job;
+        /// Stands in for the product until the job has finished, at which point the product's
+        /// representations and associated artifacts are added to it.
+        ComPtr<IArtifact> artifact;
+        /// The source that was compiled
+        ComPtr<IArtifact> sourceArtifact;
+        /// Where `artifact` is held, so it can be dropped if the compilation fails
+        TargetProgram* targetProgram = nullptr;
+        /// The entry point `artifact` is the result for, or -1 for the whole program
+        Index entryPointIndex = -1;
+    };
+
+    /// The queue to run downstream compilations on in the background, or nullptr if they should
+    /// be run as part of code generation. Only set whilst output is being generated.
+    DownstreamCompileQueue* getDownstreamCompileQueue() { return m_downstreamCompileQueue; }
+
+    /// Add a compilation started on the downstream compile queue, which will be finished (in the
+    /// order added) once all of the output has been generated.
+    void addPendingDownstreamCompile(const PendingDownstreamCompile& pending)
+    {
+        m_pendingDownstreamCompiles.add(pending);
+    }
+
 private:
     String _getWholeProgramPath(TargetRequest* targetReq);
     String _getEntryPointPath(TargetRequest* targetReq, Index entryPointIndex);
@@ -400,6 +427,9 @@ private:
     void generateOutput(ComponentType* program);
     void generateOutput(TargetProgram* targetProgram);
 
+    /// Wait for the downstream compilations running in the background, and report their results.
+    void _finishPendingDownstreamCompiles();
+
     void init();
 
     Session* m_session = nullptr;
@@ -410,6 +440,9 @@ private:
     RefPtr<ComponentType> m_specializedGlobalAndEntryPointsComponentType;
     List<RefPtr<ComponentType>> m_specializedEntryPoints;
 
+    RefPtr<DownstreamCompileQueue> m_downstreamCompileQueue;
+    List<PendingDownstreamCompile> m_pendingDownstreamCompiles;
+
     // For output
 
     RefPtr<StdWriters> m_writers;
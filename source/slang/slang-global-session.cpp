@@ -23,6 +23,10 @@ extern Slang::String get_slang_hlsl_prelude();
 namespace Slang
 {
 
+/// Suffix of the file, saved next to the core module in its archive, that holds the
+/// precomputed conversion costs between the core module's basic types.
+static const char kConversionCostTableFileSuffix[] = ".slang-conversion-costs";
+
 void Session::init()
 {
     SLANG_ASSERT(BaseTypeInfo::check());
@@ -49,6 +53,14 @@ void Session::init()
     DownstreamCompilerUtil::setDefaultLocators(m_downstreamCompilerLocators);
     m_downstreamCompilerSet = new DownstreamCompilerSet;
 
+    // IR modules of every size come and go through linking, so the pool
+    // adapts its arena block size to the modules it sees.
+    {
+        MemoryArenaPool::Desc poolDesc;
+        poolDesc.minBlockPayloadSize = IRModule::kMemoryArenaBlockSize;
+        m_irMemoryArenaPool = new MemoryArenaPool(poolDesc);
+    }
+
     m_completionTokenName = getNamePool()->getName("#?");
 
     m_sharedLibraryLoader = DefaultSharedLibraryLoader::getSingleton();
@@ -318,6 +330,34 @@ TypeCheckingCache* Session::getTypeCheckingCache()
     return static_cast<TypeCheckingCache*>(m_typeCheckingCache.get());
 }
 
+RefPtr<DownstreamCompileCache> Session::getDownstreamCompileCache(const String& directory)
+{
+    std::lock_guard<std::mutex> lock(m_downstreamCompileCacheMutex);
+
+    if (auto cache = m_downstreamCompileCaches.tryGetValue(directory))
+    {
+        return *cache;
+    }
+    RefPtr<DownstreamCompileCache> cache = new DownstreamCompileCache(directory);
+    m_downstreamCompileCaches.add(directory, cache);
+    return cache;
+}
+
+bool Session::getDownstreamCompileCacheStats(DownstreamCompileCache::Stats& outStats)
+{
+    std::lock_guard<std::mutex> lock(m_downstreamCompileCacheMutex);
+
+    outStats = DownstreamCompileCache::Stats{};
+    for (const auto& [directory, cache] : m_downstreamCompileCaches)
+    {
+        const auto stats = cache->getStats();
+        outStats.hitCount += stats.hitCount;
+        outStats.missCount += stats.missCount;
+        outStats.entryCount += stats.entryCount;
+    }
+    return m_downstreamCompileCaches.getCount() != 0;
+}
+
 Session::BuiltinModuleInfo Session::getBuiltinModuleInfo(slang::BuiltinModuleName name)
 {
     Session::BuiltinModuleInfo result;
@@ -470,6 +510,10 @@ SlangResult Session::loadBuiltinModule(
         // We need to retain this AST so that we can use it in other code
         // (Note that the `Scope` type does not retain the AST it points to)
         coreModules.add(module);
+
+        StringBuilder tableFileName;
+        tableFileName << builtinModuleInfo.name << kConversionCostTableFileSuffix;
+        _readCoreConversionCostTable(fileSystem, tableFileName);
     }
 
     return SLANG_OK;
@@ -572,6 +616,17 @@ SlangResult Session::saveBuiltinModule(
         contents.getBuffer(),
         contents.getCount()));
 
+    // The conversion costs between the basic types of the core module
+    // are the same for every session, so we compute them once here and
+    // ship them next to the module.
+    //
+    if (moduleTag == slang::BuiltinModuleName::Core)
+    {
+        StringBuilder tableFileName;
+        tableFileName << moduleName << kConversionCostTableFileSuffix;
+        SLANG_RETURN_ON_FAIL(_writeCoreConversionCostTable(module, fileSystem, tableFileName));
+    }
+
     // And finally, we can ask the archive file system to serialize itself
     // out as a blob of bytes, which yields the final serialized representation
     // of the module.
@@ -586,6 +641,142 @@ SlangResult Session::saveBuiltinModule(
     return SLANG_OK;
 }
 
+namespace
+{ // anonymous
+
+/// Header of the conversion cost table saved next to the core module.
+struct ConversionCostTableHeader
+{
+    static const uint32_t kVersion = 1;
+
+    uint32_t version = kVersion;
+
+    /// Guards against a change to the layout of `BasicTypeKey`.
+    uint32_t keySize = sizeof(BasicTypeKey);
+
+    uint32_t entryCount = 0;
+};
+
+struct ConversionCostTableEntry
+{
+    uint32_t toType;
+    uint32_t fromType;
+    uint32_t cost;
+};
+
+} // namespace
+
+SlangResult Session::_writeCoreConversionCostTable(
+    Module* coreModule,
+    ISlangMutableFileSystem* fileSystem,
+    String const& fileName)
+{
+    auto astBuilder = m_builtinLinkage->getASTBuilder();
+
+    // Enumerate the scalar types and the vectors of them.
+    //
+    static const BaseType kBaseTypes[] = {
+        BaseType::Bool,
+        BaseType::Int8,
+        BaseType::Int16,
+        BaseType::Int,
+        BaseType::Int64,
+        BaseType::UInt8,
+        BaseType::UInt16,
+        BaseType::UInt,
+        BaseType::UInt64,
+        BaseType::Half,
+        BaseType::Float,
+        BaseType::Double,
+        BaseType::IntPtr,
+        BaseType::UIntPtr,
+    };
+    List<Type*> types;
+    for (auto baseType : kBaseTypes)
+    {
+        auto scalarType = astBuilder->getBuiltinType(baseType);
+        types.add(scalarType);
+        for (IntegerLiteralValue elementCount = 2; elementCount <= 4; ++elementCount)
+        {
+            types.add(astBuilder->getVectorType(
+                scalarType,
+                astBuilder->getIntVal(astBuilder->getIntType(), elementCount)));
+        }
+    }
+
+    // Asking whether each type can be coerced to each other type fills in
+    // the `conversionCostCache` of the builtin linkage.
+    //
+    DiagnosticSink sink(m_builtinLinkage->getSourceManager(), nullptr);
+    SharedSemanticsContext sharedSemanticsContext(m_builtinLinkage, coreModule, &sink);
+    SemanticsVisitor visitor(&sharedSemanticsContext);
+    for (auto toType : types)
+    {
+        for (auto fromType : types)
+        {
+            visitor.canCoerce(toType, fromType, nullptr, nullptr);
+        }
+    }
+
+    auto& conversionCostCache = m_builtinLinkage->getTypeCheckingCache()->conversionCostCache;
+
+    ConversionCostTableHeader header;
+    header.entryCount = uint32_t(conversionCostCache.getCount());
+
+    List<uint8_t> contents;
+    contents.setCount(
+        sizeof(header) + sizeof(ConversionCostTableEntry) * Index(header.entryCount));
+    memcpy(contents.getBuffer(), &header, sizeof(header));
+    auto entries = (ConversionCostTableEntry*)(contents.getBuffer() + sizeof(header));
+    for (const auto& [key, cost] : conversionCostCache)
+    {
+        entries->toType = key.type1.getRaw();
+        entries->fromType = key.type2.getRaw();
+        entries->cost = uint32_t(cost);
+        entries++;
+    }
+
+    return fileSystem->saveFile(fileName.getBuffer(), contents.getBuffer(), contents.getCount());
+}
+
+void Session::_readCoreConversionCostTable(ISlangFileSystem* fileSystem, String const& fileName)
+{
+    // The table is optional: archives written before it was added don't have it.
+    //
+    ComPtr<ISlangBlob> blob;
+    if (SLANG_FAILED(fileSystem->loadFile(fileName.getBuffer(), blob.writeRef())))
+        return;
+
+    auto data = (const uint8_t*)blob->getBufferPointer();
+    auto size = blob->getBufferSize();
+    ConversionCostTableHeader header;
+    if (size < sizeof(header))
+        return;
+    memcpy(&header, data, sizeof(header));
+    if (header.version != ConversionCostTableHeader::kVersion ||
+        header.keySize != sizeof(BasicTypeKey) ||
+        size < sizeof(header) + sizeof(ConversionCostTableEntry) * size_t(header.entryCount))
+        return;
+
+    std::lock_guard<std::mutex> lock(m_typeCheckingCacheMutex);
+    if (!m_typeCheckingCache)
+        m_typeCheckingCache = new TypeCheckingCache();
+    auto& conversionCostCache = getTypeCheckingCache()->conversionCostCache;
+
+    auto entries = (const ConversionCostTableEntry*)(data + sizeof(header));
+    for (uint32_t i = 0; i < header.entryCount; ++i)
+    {
+        ConversionCostTableEntry entry;
+        memcpy(&entry, entries + i, sizeof(entry));
+
+        BasicTypeKeyPair key;
+        memcpy(&key.type1, &entry.toType, sizeof(key.type1));
+        memcpy(&key.type2, &entry.fromType, sizeof(key.type2));
+        conversionCostCache[key] = ConversionCost(entry.cost);
+    }
+    m_coreConversionCostTableEntryCount = Index(header.entryCount);
+}
+
 SlangResult Session::_readBuiltinModule(
     ISlangFileSystem* fileSystem,
     Scope* scope,
@@ -884,6 +1075,12 @@ SLANG_NO_THROW SlangProfileID SLANG_MCALL Session::findProfile(char const* name)
     return SlangProfileID(Slang::Profile::lookUp(name).raw);
 }
 
+SLANG_NO_THROW void SLANG_MCALL Session::releaseUnusedMemory()
+{
+    if (m_irMemoryArenaPool)
+        m_irMemoryArenaPool->trim();
+}
+
 SLANG_NO_THROW SlangCapabilityID SLANG_MCALL Session::findCapability(char const* name)
 {
     return SlangCapabilityID(Slang::findCapabilityName(UnownedTerminatedStringSlice(name)));
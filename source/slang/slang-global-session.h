@@ -12,11 +12,13 @@
 // from the public API.
 //
 
+#include "../compiler-core/slang-downstream-compile-cache.h"
 #include "../compiler-core/slang-downstream-compiler-set.h"
 #include "../compiler-core/slang-downstream-compiler-util.h"
 #include "../compiler-core/slang-downstream-compiler.h"
 #include "../compiler-core/slang-spirv-core-grammar.h"
 #include "../core/slang-command-options.h"
+#include "../core/slang-memory-arena-pool.h"
 #include "slang-pass-through.h"
 #include "slang-target.h"
 
@@ -173,6 +175,8 @@ public:
         SlangArchiveType archiveType,
         ISlangBlob** outBlob) override;
 
+    SLANG_NO_THROW void SLANG_MCALL releaseUnusedMemory() override;
+
     SLANG_NO_THROW SlangCapabilityID SLANG_MCALL findCapability(char const* name) override;
 
     SLANG_NO_THROW void SLANG_MCALL setDownstreamCompilerForTransition(
@@ -336,6 +340,21 @@ public:
     TypeCheckingCache* getTypeCheckingCache();
     std::mutex m_typeCheckingCacheMutex;
 
+    /// Number of conversion costs preloaded from the table saved with the core module.
+    Index m_coreConversionCostTableEntryCount = 0;
+
+    /// Pool of memory arenas shared by the `IRModule`s created in this session.
+    MemoryArenaPool* getIRMemoryArenaPool() { return m_irMemoryArenaPool; }
+    RefPtr<MemoryArenaPool> m_irMemoryArenaPool;
+
+    /// Get the cache of downstream compilations kept in `directory`, creating it if needed.
+    RefPtr<DownstreamCompileCache> getDownstreamCompileCache(const String& directory);
+    /// Get the total hits, misses and entries of the downstream compile caches.
+    /// Returns false if no cache has been used.
+    bool getDownstreamCompileCacheStats(DownstreamCompileCache::Stats& outStats);
+    Dictionary<String, RefPtr<DownstreamCompileCache>> m_downstreamCompileCaches;
+    std::mutex m_downstreamCompileCacheMutex;
+
 private:
     struct BuiltinModuleInfo
     {
@@ -355,6 +374,17 @@ private:
 
     SlangResult _loadRequest(EndToEndCompileRequest* request, const void* data, size_t size);
 
+    /// Compute the conversion costs between the scalar and vector types of
+    /// `coreModule`, and save them as `fileName` in `fileSystem`.
+    SlangResult _writeCoreConversionCostTable(
+        Module* coreModule,
+        ISlangMutableFileSystem* fileSystem,
+        String const& fileName);
+
+    /// Preload the conversion costs saved by `_writeCoreConversionCostTable`, if
+    /// `fileSystem` contains them, into the type checking cache shared by all sessions.
+    void _readCoreConversionCostTable(ISlangFileSystem* fileSystem, String const& fileName);
+
     /// Linkage used for all built-in (core module) code.
     RefPtr<Linkage> m_builtinLinkage;
 
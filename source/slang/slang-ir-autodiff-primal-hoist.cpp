@@ -417,7 +417,7 @@ RefPtr<HoistedPrimalsInfo> AutodiffCheckpointPolicyBase::processFunc(
 
     RefPtr<CheckpointSetInfo> checkpointInfo = new CheckpointSetInfo();
 
-    RefPtr<IRDominatorTree> domTree = computeDominatorTree(func);
+    RefPtr<IRDominatorTree> domTree = findOrComputeDominatorTree(func);
 
     List<UseOrPseudoUse> workList;
     HashSet<UseOrPseudoUse> processedUses;
@@ -1120,7 +1120,7 @@ void AutodiffCheckpointPolicyBase::collectLoopExitConditions(IRGlobalValueWithCo
 {
     // Assume that the InductionValueInfo is already collected.
     IRBuilder builder(func->getModule());
-    RefPtr<IRDominatorTree> domTree = computeDominatorTree(func);
+    RefPtr<IRDominatorTree> domTree = findOrComputeDominatorTree(func);
     for (auto block : func->getBlocks())
     {
         auto loopInst = as<IRLoop>(block->getTerminator());
@@ -1950,7 +1950,7 @@ RefPtr<HoistedPrimalsInfo> ensurePrimalAvailability(
     // }
     //
 
-    RefPtr<IRDominatorTree> domTree = computeDominatorTree(func);
+    RefPtr<IRDominatorTree> domTree = findOrComputeDominatorTree(func);
 
     IRBlock* defaultVarBlock = func->getFirstBlock()->getNextBlock();
 
@@ -862,4 +862,31 @@ RefPtr<IRDominatorTree> computeDominatorTree(IRGlobalValueWithCode* code)
     return context.createDominatorTree(code);
 }
 
+RefPtr<IRDominatorTree> findOrComputeDominatorTree(IRGlobalValueWithCode* code)
+{
+    if (auto module = code->getModule())
+        return module->findOrCreateDominatorTree(code);
+    return computeDominatorTree(code);
+}
+
+HashCode64 computeCFGHash(IRGlobalValueWithCode* code)
+{
+    Hasher hasher;
+    for (auto block : code->getBlocks())
+    {
+        hasher.hashValue(block);
+
+        Count successorCount = 0;
+        for (auto successor : block->getSuccessors())
+        {
+            hasher.hashValue(successor);
+            successorCount++;
+        }
+
+        // Mix in the count so that edges can't be attributed to the wrong block.
+        hasher.hashValue(successorCount);
+    }
+    return hasher.getResult();
+}
+
 } // namespace Slang
@@ -167,6 +167,21 @@ private:
 
 RefPtr<IRDominatorTree> computeDominatorTree(IRGlobalValueWithCode* code);
 
+/// Get the dominator tree for `code`.
+///
+/// If `code` belongs to a module, the tree is cached on the module and reused
+/// until the control-flow graph of `code` changes (see
+/// `IRModule::findOrCreateDominatorTree`). Otherwise a new tree is computed.
+///
+RefPtr<IRDominatorTree> findOrComputeDominatorTree(IRGlobalValueWithCode* code);
+
+/// Compute a hash of the control-flow graph of `code`: its blocks, in order,
+/// and the successor edges of each block.
+///
+/// Two CFGs with the same hash have (barring collisions) the same dominator tree,
+/// which lets a cached tree be checked for staleness without recomputing it.
+HashCode64 computeCFGHash(IRGlobalValueWithCode* code);
+
 void computePostorder(IRGlobalValueWithCode* code, List<IRBlock*>& outOrder);
 void computeMirroredPostorder(IRGlobalValueWithCode* code, List<IRBlock*>& outOrder);
 void computePostorder(
@@ -50,10 +50,16 @@ struct IRSharedSpecContext
     // A map from mangled symbol names to zero or
     // more global IR values that have that name,
     // in the *original* module.
-    typedef Dictionary<ImmutableHashedString, RefPtr<IRSpecSymbol>> SymbolDictionary;
+    typedef Dictionary<
+        ImmutableHashedString,
+        RefPtr<IRSpecSymbol>,
+        ImmutableHashedStringHash,
+        ImmutableHashedStringEqual>
+        SymbolDictionary;
     SymbolDictionary symbols;
 
-    Dictionary<ImmutableHashedString, bool> isImportedSymbol;
+    Dictionary<ImmutableHashedString, bool, ImmutableHashedStringHash, ImmutableHashedStringEqual>
+        isImportedSymbol;
 
     bool useAutodiff = false;
 
@@ -91,18 +97,20 @@ struct IRSpecContextBase
 
     IRSpecSymbol* findSymbols(UnownedStringSlice mangledName)
     {
-        ImmutableHashedString hashedName(mangledName);
+        // The symbol tables support lookup by slice, so we only
+        // need to create an owned key if we end up adding one.
+        //
         RefPtr<IRSpecSymbol> symbol;
-        if (shared->symbols.tryGetValue(hashedName, symbol))
+        if (shared->symbols.tryGetValue(mangledName, symbol))
             return symbol;
         for (auto m : irModules)
         {
-            for (auto inst : m->findSymbolByMangledName(hashedName))
+            for (auto inst : m->findSymbolByMangledName(mangledName))
                 insertGlobalValueSymbol(shared, inst);
         }
-        if (shared->symbols.tryGetValue(hashedName, symbol))
+        if (shared->symbols.tryGetValue(mangledName, symbol))
             return symbol;
-        shared->symbols[hashedName] = nullptr;
+        shared->symbols[ImmutableHashedString(mangledName)] = nullptr;
         return nullptr;
     }
 
@@ -1617,7 +1625,8 @@ void insertGlobalValueSymbol(IRSharedSpecContext* sharedContext, IRInst* gv)
     if (!linkage)
         return;
 
-    auto mangledName = String(linkage->getMangledName());
+    // Hash the name once, rather than for each of the table operations below.
+    ImmutableHashedString mangledName(linkage->getMangledName());
 
     RefPtr<IRSpecSymbol> sym = new IRSpecSymbol();
     sym->irGlobalValue = gv;
@@ -2102,6 +2111,96 @@ bool doesModuleUseAutodiff(IRInst* inst)
     }
 }
 
+// Information about a module that every `linkIR` call using it needs.
+//
+// Gathering it means walking all of the global insts of the module (and,
+// for `autodiffUse`, every function body), while the same modules are
+// linked for every entry point and target compiled in a session, so we
+// compute the information once per module and cache it on the `IRModule`.
+//
+// Code that adds or removes global insts, or changes their decorations,
+// after the module has been finalized (such as `Module::precompileForTarget`)
+// is responsible for calling `IRModule::invalidateLinkInfo`.
+//
+struct IRModuleLinkInfo : public RefObject
+{
+    // A global inst that may need to be cloned into every linked
+    // module, even if nothing references it.
+    //
+    struct RootInst
+    {
+        IRInst* inst;
+        bool isExported;
+        bool isGlobalParam;
+        bool isAutodiffInst;
+    };
+
+    // Insts that are always cloned when the module is a user module,
+    // in module order.
+    List<IRInst*> alwaysClonedInsts;
+
+    // Insts that are cloned depending on the link options, in module order.
+    List<RootInst> rootInsts;
+
+    // Computed on demand, since it requires walking every function body.
+    enum class AutodiffUse
+    {
+        Unknown,
+        No,
+        Yes
+    };
+    AutodiffUse autodiffUse = AutodiffUse::Unknown;
+};
+
+static RefPtr<IRModuleLinkInfo> _getModuleLinkInfo(IRModule* module)
+{
+    std::lock_guard<std::mutex> lock(module->getLinkInfoMutex());
+    if (auto existing = module->getLinkInfo())
+        return static_cast<IRModuleLinkInfo*>(existing);
+
+    RefPtr<IRModuleLinkInfo> info = new IRModuleLinkInfo();
+    for (auto inst : module->getGlobalInsts())
+    {
+        switch (inst->getOp())
+        {
+        case kIROp_BindGlobalGenericParam:
+        case kIROp_DebugSource:
+        case kIROp_DebugBuildIdentifier:
+            info->alwaysClonedInsts.add(inst);
+            break;
+        default:
+            break;
+        }
+
+        IRModuleLinkInfo::RootInst rootInst;
+        rootInst.inst = inst;
+        rootInst.isExported = _isHLSLExported(inst);
+        rootInst.isGlobalParam = as<IRGlobalParam>(inst) != nullptr;
+        rootInst.isAutodiffInst =
+            as<IRDifferentiableTypeAnnotation>(inst) ||
+            inst->findDecorationImpl(kIROp_AutoDiffBuiltinDecoration) != nullptr;
+        if (rootInst.isExported || rootInst.isGlobalParam || rootInst.isAutodiffInst)
+            info->rootInsts.add(rootInst);
+    }
+
+    module->setLinkInfo(info);
+    return info;
+}
+
+static bool _doesModuleUseAutodiff(IRModule* module)
+{
+    auto info = _getModuleLinkInfo(module);
+
+    std::lock_guard<std::mutex> lock(module->getLinkInfoMutex());
+    if (info->autodiffUse == IRModuleLinkInfo::AutodiffUse::Unknown)
+    {
+        info->autodiffUse = doesModuleUseAutodiff(module->getModuleInst())
+                                ? IRModuleLinkInfo::AutodiffUse::Yes
+                                : IRModuleLinkInfo::AutodiffUse::No;
+    }
+    return info->autodiffUse == IRModuleLinkInfo::AutodiffUse::Yes;
+}
+
 void cloneUsedWitnessTableEntries(IRSpecContext* context)
 {
     bool changed = true;
@@ -2200,7 +2299,7 @@ LinkedIR linkIR(CodeGenContext* codeGenContext)
     {
         if (sharedContext->useAutodiff)
             break;
-        sharedContext->useAutodiff = doesModuleUseAutodiff(irModule->getModuleInst());
+        sharedContext->useAutodiff = _doesModuleUseAutodiff(irModule);
     }
 
     auto context = state->getContext();
@@ -2266,39 +2365,31 @@ LinkedIR linkIR(CodeGenContext* codeGenContext)
 
     // Clone additional insts that should be included in the linked IR module
     // even if they are not being directly referenced.
+    //
+    // Bindings for global generic parameters are currently represented
+    // as stand-alone global-scope instructions in the IR module for
+    // `SpecializedComponentType`s. These instructions are required for
+    // correct codegen, and so we must make sure to copy them all over,
+    // even though they are not directly referenced.
+    //
+    // TODO: We should change these to decorations, akin to how
+    // `[bindExistentialSlots(...)]` works, so that they can be attached
+    // to the relevant parameters and cloned via `cloneExtraDecorations`.
+    // In the long run we do not want to *ever* iterate over all the
+    // instructions in all the input modules.
+    //
+    // We also need to list all source files in the debug source file list,
+    // regardless if the source files participate in the line table or not,
+    // and keep any debug build identifier, which won't be referenced by anything.
+    //
+    // The set of such insts in each module is cached by `_getModuleLinkInfo`,
+    // so we don't need to walk the modules again for every entry point.
+    //
     for (IRModule* irModule : userModules)
     {
-        for (auto inst : irModule->getGlobalInsts())
-        {
-            switch (inst->getOp())
-            {
-            default:
-                break;
-            case kIROp_BindGlobalGenericParam:
-                // Bindings for global generic parameters are currently represented
-                // as stand-alone global-scope instructions in the IR module for
-                // `SpecializedComponentType`s. These instructions are required for
-                // correct codegen, and so we must make sure to copy them all over,
-                // even though they are not directly referenced.
-                //
-                // TODO: We should change these to decorations, akin to how
-                // `[bindExistentialSlots(...)]` works, so that they can be attached
-                // to the relevant parameters and cloned via `cloneExtraDecorations`.
-                // In the long run we do not want to *ever* iterate over all the
-                // instructions in all the input modules.
-                [[fallthrough]];
-            case kIROp_DebugSource:
-                // Need to list all source files in the debug source file list,
-                // regardless if the source files participate in the line table or not.
-                cloneValue(context, inst);
-                break;
-            case kIROp_DebugBuildIdentifier:
-                // The debug build identifier won't be referenced by anything,
-                // but we still need to keep it around if it is in the IR.
-                cloneValue(context, inst);
-                break;
-            }
-        }
+        auto linkInfo = _getModuleLinkInfo(irModule);
+        for (auto inst : linkInfo->alwaysClonedInsts)
+            cloneValue(context, inst);
     }
 
     bool shouldCopyGlobalParams =
@@ -2306,16 +2397,15 @@ LinkedIR linkIR(CodeGenContext* codeGenContext)
 
     for (IRModule* irModule : irModules)
     {
-        for (auto inst : irModule->getGlobalInsts())
+        auto linkInfo = _getModuleLinkInfo(irModule);
+        for (auto const& rootInst : linkInfo->rootInsts)
         {
             // We need to copy over exported symbols,
             // and any global parameters if preserve-params option is set.
-            if (_isHLSLExported(inst) || shouldCopyGlobalParams && as<IRGlobalParam>(inst) ||
-                sharedContext->useAutodiff &&
-                    (as<IRDifferentiableTypeAnnotation>(inst) ||
-                     inst->findDecorationImpl(kIROp_AutoDiffBuiltinDecoration) != nullptr))
+            if (rootInst.isExported || shouldCopyGlobalParams && rootInst.isGlobalParam ||
+                sharedContext->useAutodiff && rootInst.isAutodiffInst)
             {
-                auto cloned = cloneValue(context, inst);
+                auto cloned = cloneValue(context, rootInst.inst);
                 if (!cloned->findDecorationImpl(kIROp_KeepAliveDecoration))
                 {
                     context->builder->addKeepAliveDecoration(cloned);
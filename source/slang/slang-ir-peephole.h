@@ -22,6 +22,7 @@ struct PeepholeOptimizationOptions
 /// Apply peephole optimizations.
 bool peepholeOptimize(TargetProgram* target, IRModule* module, PeepholeOptimizationOptions options);
 bool peepholeOptimize(TargetProgram* target, IRInst* func);
+bool peepholeOptimize(TargetProgram* target, IRInst* func, PeepholeOptimizationOptions options);
 bool peepholeOptimizeInst(TargetProgram* target, IRModule* module, IRInst* inst);
 bool peepholeOptimizeGlobalScope(TargetProgram* target, IRModule* module);
 bool tryReplaceInstUsesWithSimplifiedValue(TargetProgram* target, IRModule* module, IRInst* inst);
@@ -322,7 +322,7 @@ bool removeRedundancyInFunc(IRGlobalValueWithCode* func, bool hoistLoopInvariant
         return false;
 
     RedundancyRemovalContext context;
-    context.dom = computeDominatorTree(func);
+    context.dom = findOrComputeDominatorTree(func);
     Dictionary<IRBlock*, DeduplicateContext> mapBlockToDeduplicateContext;
     for (auto block : func->getBlocks())
     {
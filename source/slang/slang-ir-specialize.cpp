@@ -260,6 +260,25 @@ struct SpecializationContext
         }
     }
 
+    // The module-scope insts that contained an instruction that was
+    // specialized during the current sweep of the work list, in the
+    // order they were changed. The next sweep starts from these.
+    //
+    List<IRInst*> changedGlobalInsts;
+
+    // Get the ancestor of `inst` that is a direct child of the module,
+    // or nullptr if `inst` is the module itself.
+    //
+    IRInst* getModuleScopeInst(IRInst* inst)
+    {
+        auto moduleInst = module->getModuleInst();
+        if (inst == moduleInst)
+            return nullptr;
+        while (inst->getParent() && inst->getParent() != moduleInst)
+            inst = inst->getParent();
+        return inst;
+    }
+
     // Of course, somewhere along the way we expect
     // to run into uses of `specialize(...)` instructions
     // to bind a generic to arguments that we want to
@@ -1177,10 +1196,39 @@ struct SpecializationContext
         for (;;)
         {
             bool iterChanged = false;
+            bool isFirstSweep = true;
             for (;;)
             {
                 bool hasSpecialization = false;
-                addToWorkList(module->getModuleInst());
+                Count visitedInstCount = 0;
+
+                // The first sweep after the module-level passes below must
+                // visit the whole module, because those passes don't tell
+                // us what they changed.
+                //
+                // Later sweeps only need to revisit the module-scope insts
+                // that contained a change in the previous sweep: the
+                // transformations already put the users of anything they
+                // replace on the work list, so a change can only have
+                // been missed if it created new instructions next to the
+                // one being specialized. `addToWorkList` also pulls in the
+                // (transitive) users of each of those insts for us.
+                //
+                const bool isFullSweep = isFirstSweep || options.fullSweep;
+                if (isFullSweep)
+                {
+                    addToWorkList(module->getModuleInst());
+                }
+                else
+                {
+                    for (auto changedInst : changedGlobalInsts)
+                    {
+                        if (changedInst->getParent())
+                            addToWorkList(changedInst);
+                    }
+                }
+                changedGlobalInsts.clear();
+                isFirstSweep = false;
 
                 // We will then iterate until our work list goes dry.
                 //
@@ -1194,6 +1242,8 @@ struct SpecializationContext
                     if (!inst->getParent() && inst->getOp() != kIROp_ModuleInst)
                         continue;
 
+                    visitedInstCount++;
+
                     // For each instruction we process, we want to perform
                     // a few steps.
                     //
@@ -1203,7 +1253,16 @@ struct SpecializationContext
                     //
                     if (inst->hasUses() || inst->mightHaveSideEffects() || isWitnessTableType(inst))
                     {
-                        hasSpecialization |= maybeSpecializeInst(inst);
+                        // The inst may be removed by specialization, so find
+                        // where it lives up front.
+                        //
+                        auto globalInst = getModuleScopeInst(inst);
+                        if (maybeSpecializeInst(inst))
+                        {
+                            hasSpecialization = true;
+                            if (globalInst)
+                                changedGlobalInsts.add(globalInst);
+                        }
                     }
 
                     // Finally, we need to make our logic recurse through
@@ -1229,6 +1288,14 @@ struct SpecializationContext
                         addToWorkList(child);
                     }
                 }
+                auto& stats = getSpecializationStats();
+                stats.sweepCount++;
+                stats.visitedInstCount += visitedInstCount;
+                if (isFullSweep)
+                    stats.fullSweepCount++;
+                else
+                    stats.incrementalVisitedInstCount += visitedInstCount;
+
                 if (hasSpecialization)
                     iterChanged = true;
                 else
@@ -3109,6 +3176,13 @@ struct SpecializationContext
     }
 };
 
+static thread_local SpecializationStats gSpecializationStats;
+
+SpecializationStats& getSpecializationStats()
+{
+    return gSpecializationStats;
+}
+
 bool specializeModule(
     IRModule* module,
     TargetProgram* target,
@@ -3116,6 +3190,7 @@ bool specializeModule(
     SpecializationOptions options)
 {
     SLANG_PROFILE;
+
     SpecializationContext context(module, target, options);
     context.sink = sink;
     context.processModule();
@@ -1,6 +1,8 @@
 // slang-ir-specialize.h
 #pragma once
 
+#include "../core/slang-basic.h"
+
 namespace Slang
 {
 struct IRModule;
@@ -9,6 +11,25 @@ struct IRSpecialize;
 class DiagnosticSink;
 class TargetProgram;
 
+/// Counters for the work done by `specializeModule`, reported by `-report-perf-benchmark`.
+struct SpecializationStats
+{
+    /// Number of sweeps of the specialization work list.
+    UInt64 sweepCount = 0;
+
+    /// Number of those sweeps that visited the whole module.
+    UInt64 fullSweepCount = 0;
+
+    /// Number of instructions visited by all sweeps.
+    UInt64 visitedInstCount = 0;
+
+    /// Number of instructions visited by the sweeps that only revisited what changed.
+    UInt64 incrementalVisitedInstCount = 0;
+};
+
+/// Get the specialization counters for the current thread.
+SpecializationStats& getSpecializationStats();
+
 struct SpecializationOptions
 {
     // Option that allows specializeModule to generate dynamic-dispatch code
@@ -18,6 +39,13 @@ struct SpecializationOptions
 
     // Option to report dynamic dispatch sites.
     bool reportDynamicDispatchSites = false;
+
+    // Revisit the whole module on every sweep of the specialization work list,
+    // rather than only the parts affected by the previous sweep. This is slower,
+    // and is only intended for checking the incremental work list
+    // (`-specialize-full-sweep`).
+    //
+    bool fullSweep = false;
 };
 
 /// Specialize generic and interface-based code to use concrete types.
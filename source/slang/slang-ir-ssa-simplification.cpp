@@ -47,6 +47,36 @@ IRSimplificationOptions IRSimplificationOptions::getFast(TargetProgram* targetPr
     return result;
 }
 
+// Remove from `cleanFuncs` every code-bearing global value that refers to
+// `changedFunc`, either directly (e.g. a call) or through other module-scope
+// insts such as specializations and witness tables, so that it is revisited.
+static void _markUsersDirty(IRInst* changedFunc, HashSet<IRInst*>& cleanFuncs)
+{
+    List<IRInst*> workList;
+    HashSet<IRInst*> visited;
+    workList.add(changedFunc);
+    visited.add(changedFunc);
+
+    for (Index i = 0; i < workList.getCount(); i++)
+    {
+        for (auto use = workList[i]->firstUse; use; use = use->nextUse)
+        {
+            // Find the module-scope inst that contains the user.
+            IRInst* user = use->getUser();
+            while (user->getParent() && !as<IRModuleInst>(user->getParent()))
+                user = user->getParent();
+
+            if (!visited.add(user))
+                continue;
+
+            if (as<IRGlobalValueWithCode>(user))
+                cleanFuncs.remove(user);
+            else
+                workList.add(user);
+        }
+    }
+}
+
 // Run a combination of SSA, SCCP, SimplifyCFG, and DeadCodeElimination pass
 // until no more changes are possible.
 void simplifyIR(
@@ -61,26 +91,53 @@ void simplifyIR(
     const int kMaxFuncIterations = 16;
     int iterationCounter = 0;
 
+    // Functions that reached a fixed point in an earlier round, and that
+    // have not been affected by any change since. Re-running the per-function
+    // passes on these would find nothing to do, so each round skips them.
+    //
+    HashSet<IRInst*> cleanFuncs;
+
     while (changed && iterationCounter < kMaxIterations)
     {
         if (sink && sink->getErrorCount())
             break;
 
+        // The invocation counts of this section and `simplifyIRFunc` below
+        // (reported with `-report-perf-benchmark`) give the number of rounds,
+        // and of functions visited across all rounds.
+        SLANG_PROFILE_SECTION(simplifyIRRound);
+
         changed = false;
 
-        changed |= deduplicateGenericChildren(module);
-        changed |= propagateFuncProperties(module);
-        changed |= removeUnusedGenericParam(module);
-        changed |= applySparseConditionalConstantPropagationForGlobalScope(module, target, sink);
-        changed |= peepholeOptimizeGlobalScope(target, module);
-        changed |= trimOptimizableTypes(module);
+        bool globalChanged = false;
+        globalChanged |= deduplicateGenericChildren(module);
+        globalChanged |= propagateFuncProperties(module);
+        globalChanged |= removeUnusedGenericParam(module);
+        globalChanged |=
+            applySparseConditionalConstantPropagationForGlobalScope(module, target, sink);
+        globalChanged |= peepholeOptimizeGlobalScope(target, module);
+        globalChanged |= trimOptimizableTypes(module);
+
+        // The module-level passes can change things any function depends on,
+        // such as function properties or global constants, so after they
+        // change anything every function needs to be visited again.
+        //
+        if (globalChanged)
+            cleanFuncs.clear();
+        changed |= globalChanged;
 
         for (auto inst : module->getGlobalInsts())
         {
             auto func = as<IRGlobalValueWithCode>(inst);
             if (!func)
                 continue;
+            if (cleanFuncs.contains(func))
+                continue;
+
+            SLANG_PROFILE_SECTION(simplifyIRFunc);
+
             bool funcChanged = true;
+            bool funcEverChanged = false;
             int funcIterationCount = 0;
             while (funcChanged && funcIterationCount < kMaxFuncIterations)
             {
@@ -101,9 +158,19 @@ void simplifyIR(
                 eliminateDeadCode(func, options.deadCodeElimOptions);
                 if (funcIterationCount == 0)
                     funcChanged |= constructSSA(func);
+                funcEverChanged |= funcChanged;
                 changed |= funcChanged;
                 funcIterationCount++;
             }
+
+            // If we stopped because nothing changed (rather than because we ran
+            // out of iterations), the function is at a fixed point. Anything that
+            // refers to it may be able to simplify further if it did change, though.
+            //
+            if (!funcChanged)
+                cleanFuncs.add(func);
+            if (funcEverChanged)
+                _markUsersDirty(func, cleanFuncs);
         }
         iterationCounter++;
     }
@@ -2084,13 +2084,13 @@ List<IRBlock*> collectBlocksInRegion(
     IRLoop* loopInst,
     bool* outHasMultiLevelBreaks)
 {
-    auto dom = computeDominatorTree(func);
+    auto dom = findOrComputeDominatorTree(func);
     return collectBlocksInRegion(dom, loopInst, outHasMultiLevelBreaks);
 }
 
 List<IRBlock*> collectBlocksInRegion(IRGlobalValueWithCode* func, IRLoop* loopInst)
 {
-    auto dom = computeDominatorTree(func);
+    auto dom = findOrComputeDominatorTree(func);
     bool hasMultiLevelBreaks = false;
     return collectBlocksInRegion(dom, loopInst, &hasMultiLevelBreaks);
 }
@@ -2608,7 +2608,7 @@ void legalizeDefUse(IRGlobalValueWithCode* func, TargetProgram* target)
     // fixes up such situations by creating temporary variables in the common dominator block, and
     // insert a store to the variable in the inner region, and replacing the uses with loads from
     // the variable.
-    auto dom = computeDominatorTree(func);
+    auto dom = findOrComputeDominatorTree(func);
 
     // Make a map of loop condition blocks to their loop header.
     // We need this because we'll be treating loop condition blocks as
@@ -383,6 +383,27 @@ void validateCodeBody(IRValidateContext* context, IRGlobalValueWithCode* code)
     }
 }
 
+// The module only hands out a cached dominator tree while the control flow it was computed
+// from is unchanged, so the tree has to agree with a freshly computed one.
+void validateCachedDominatorTree(IRValidateContext* context, IRGlobalValueWithCode* code)
+{
+    if (!context->module)
+        return;
+    auto cachedDomTree = context->module->findDominatorTree(code);
+    if (!cachedDomTree)
+        return;
+    for (auto block : code->getBlocks())
+    {
+        validate(
+            context,
+            cachedDomTree->isUnreachable(block) == context->domTree->isUnreachable(block) &&
+                cachedDomTree->getImmediateDominator(block) ==
+                    context->domTree->getImmediateDominator(block),
+            block,
+            "cached dominator tree must match the control flow of its function.");
+    }
+}
+
 void validateIRInst(IRValidateContext* context, IRInst* inst)
 {
     // Validate that any operands of the instruction are used appropriately
@@ -392,6 +413,7 @@ void validateIRInst(IRValidateContext* context, IRInst* inst)
     if (auto code = as<IRGlobalValueWithCode>(inst))
     {
         context->domTree = computeDominatorTree(code);
+        validateCachedDominatorTree(context, code);
         validateCodeBody(context, code);
     }
 
@@ -4,6 +4,7 @@
 #include "../core/slang-basic.h"
 #include "../core/slang-platform.h"
 #include "../core/slang-writer.h"
+#include "slang-global-session.h"
 #include "slang-ir-dominators.h"
 #include "slang-ir-insts.h"
 #include "slang-ir-util.h"
@@ -4523,6 +4524,29 @@ IRInst* IRBuilder::addIntermediateContextFieldDifferentialTypeDecoration(
     return addDecoration(target, kIROp_IntermediateContextFieldDifferentialTypeDecoration, witness);
 }
 
+IRModule::IRModule(Session* session)
+    : m_session(session), m_memoryArena(kMemoryArenaBlockSize), m_deduplicationContext(this)
+{
+    // Reuse arena blocks released by modules that have since been destroyed,
+    // rather than allocating fresh ones for every module (a compile service
+    // creates and drops a linked module for every variant it compiles).
+    if (session)
+    {
+        m_memoryArenaPool = session->getIRMemoryArenaPool();
+        if (m_memoryArenaPool)
+            m_memoryArenaPool->acquire(m_memoryArena);
+    }
+}
+
+IRModule::~IRModule()
+{
+    // The instructions in the arena are never destroyed individually, and
+    // nothing that outlives the module may reference them, so the blocks
+    // can go back to the pool as they are.
+    if (m_memoryArenaPool)
+        m_memoryArenaPool->release(m_memoryArena);
+}
+
 RefPtr<IRModule> IRModule::create(Session* session)
 {
     RefPtr<IRModule> module = new IRModule(session);
@@ -4535,8 +4559,15 @@ RefPtr<IRModule> IRModule::create(Session* session)
     return module;
 }
 
+void IRModule::invalidateLinkInfo()
+{
+    std::lock_guard<std::mutex> lock(m_linkInfoMutex);
+    m_linkInfo = nullptr;
+}
+
 void IRModule::buildMangledNameToGlobalInstMap()
 {
+    invalidateLinkInfo();
     m_mapMangledNameToGlobalInst.clear();
     for (auto inst : getGlobalInsts())
     {
@@ -4547,17 +4578,46 @@ void IRModule::buildMangledNameToGlobalInstMap()
     }
 }
 
+static thread_local IRAnalysisStats gIRAnalysisStats;
+
+IRAnalysisStats& getIRAnalysisStats()
+{
+    return gIRAnalysisStats;
+}
+
+IRDominatorTree* IRModule::findDominatorTree(IRGlobalValueWithCode* func)
+{
+    IRAnalysis* analysis = m_mapInstToAnalysis.tryGetValue(func);
+    if (!analysis || !analysis->domTree)
+        return nullptr;
+    if (analysis->domTreeCFGHash != computeCFGHash(func))
+        return nullptr;
+    return analysis->getDominatorTree();
+}
+
 IRDominatorTree* IRModule::findOrCreateDominatorTree(IRGlobalValueWithCode* func)
 {
+    // Hashing the CFG is a single walk over the blocks and their
+    // terminators, which is much cheaper than recomputing the tree.
+    const HashCode64 cfgHash = computeCFGHash(func);
+
     IRAnalysis* analysis = m_mapInstToAnalysis.tryGetValue(func);
     if (analysis)
-        return analysis->getDominatorTree();
+    {
+        if (analysis->domTree && analysis->domTreeCFGHash == cfgHash)
+        {
+            getIRAnalysisStats().dominatorTreeHitCount++;
+            return analysis->getDominatorTree();
+        }
+    }
     else
     {
         m_mapInstToAnalysis[func] = IRAnalysis();
         analysis = m_mapInstToAnalysis.tryGetValue(func);
     }
+    getIRAnalysisStats().dominatorTreeMissCount++;
     analysis->domTree = computeDominatorTree(func);
+    analysis->domTreeCFGHash = cfgHash;
     return analysis->getDominatorTree();
 }
 
@@ -8425,6 +8485,14 @@ void IRInst::removeFromParent()
     if (!oldParent)
         return;
 
+    // Analyses cached for a function are dropped along with it, so that
+    // they don't outlive the function in the module it was removed from.
+    if (auto func = as<IRGlobalValueWithCode>(this))
+    {
+        if (auto module = oldParent->getModule())
+            module->invalidateAnalysisForInst(func);
+    }
+
     auto pp = getPrevInst();
     auto nn = getNextInst();
 
@@ -8491,8 +8559,6 @@ void IRInst::removeAndDeallocate()
             module->getDeduplicationContext()->removeInstFromConstantMap(constInst);
         }
         module->getDeduplicationContext()->getInstReplacementMap().remove(this);
-        if (auto func = as<IRGlobalValueWithCode>(this))
-            module->invalidateAnalysisForInst(func);
     }
     removeArguments();
     removeFromParent();
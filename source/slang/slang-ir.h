@@ -9,6 +9,7 @@
 #include "../compiler-core/slang-source-loc.h"
 #include "../compiler-core/slang-source-map.h"
 #include "../core/slang-basic.h"
+#include "../core/slang-memory-arena-pool.h"
 #include "../core/slang-memory-arena.h"
 #include "slang-ast-type.h"
 #include "slang-container-pool.h"
@@ -16,6 +17,7 @@
 #include "slang-type-system-shared.h"
 
 #include <functional>
+#include <mutex>
 
 //
 #include "slang-ir.h.fiddle"
@@ -2026,9 +2028,23 @@ struct IRDominatorTree;
 struct IRAnalysis
 {
     RefPtr<RefObject> domTree;
+
+    /// Hash of the control-flow graph `domTree` was computed from (see `computeCFGHash`).
+    HashCode64 domTreeCFGHash = 0;
+
     IRDominatorTree* getDominatorTree();
 };
 
+/// Counts of how often analyses cached on an `IRModule` could be reused.
+struct IRAnalysisStats
+{
+    UInt64 dominatorTreeHitCount = 0;
+    UInt64 dominatorTreeMissCount = 0;
+};
+
+/// Get the analysis cache counters for the current thread.
+IRAnalysisStats& getIRAnalysisStats();
+
 FIDDLE()
 struct IRModule : RefObject
 {
@@ -2041,6 +2057,8 @@ public:
 
     static RefPtr<IRModule> create(Session* session);
 
+    ~IRModule();
+
     SLANG_FORCE_INLINE Session* getSession() const { return m_session; }
     SLANG_FORCE_INLINE IRModuleInst* getModuleInst() const { return m_moduleInst; }
     SLANG_FORCE_INLINE MemoryArena& getMemoryArena() { return m_memoryArena; }
@@ -2061,20 +2079,52 @@ public:
         return {};
     }
 
+    ArrayView<IRInst*> findSymbolByMangledName(const UnownedStringSlice& mangledName) const
+    {
+        if (auto list = m_mapMangledNameToGlobalInst.tryGetValue(mangledName))
+            return list->getArrayView();
+        return {};
+    }
+
     void buildMangledNameToGlobalInstMap();
 
+    /// Information about this module cached by the linker, so that it doesn't
+    /// need to be recomputed for every entry point and target linked against
+    /// the module (see `slang-ir-link.cpp`).
+    ///
+    /// The information is derived from the global insts of the module and their
+    /// decorations, so any code that changes those after the module has been
+    /// finalized must call `invalidateLinkInfo`. Like the mangled name map, it is
+    /// also discarded by `buildMangledNameToGlobalInstMap`.
+    ///
+    /// A module (such as the core module) can be linked from several threads at
+    /// once, so `getLinkInfo` and `setLinkInfo` must only be called while holding
+    /// the lock returned by `getLinkInfoMutex`.
+    ///
+    RefObject* getLinkInfo() const { return m_linkInfo; }
+    void setLinkInfo(RefObject* linkInfo) { m_linkInfo = linkInfo; }
+    std::mutex& getLinkInfoMutex() { return m_linkInfoMutex; }
+    void invalidateLinkInfo();
+
     IRDeduplicationContext* getDeduplicationContext() const { return &m_deduplicationContext; }
 
     Dictionary<IRInst*, UInt>* getUniqueIdMap() { return &m_mapInstToUniqueId; }
 
-    IRDominatorTree* findDominatorTree(IRGlobalValueWithCode* func)
-    {
-        IRAnalysis* analysis = m_mapInstToAnalysis.tryGetValue(func);
-        if (analysis)
-            return analysis->getDominatorTree();
-        return nullptr;
-    }
+    /// Get the cached dominator tree for `func`, or nullptr if there is none,
+    /// or if the control-flow graph of `func` has changed since it was computed.
+    IRDominatorTree* findDominatorTree(IRGlobalValueWithCode* func);
+
+    /// Get the dominator tree for `func`, computing it if there is no
+    /// up-to-date cached tree.
+    ///
+    /// A cached tree is only reused if the blocks of `func` and the edges
+    /// between them are unchanged, so passes that modify the control flow
+    /// don't need to invalidate the cache for correctness. Calling
+    /// `invalidateAnalysisForInst` still releases the memory earlier, and
+    /// is done when a function is removed from the module.
+    ///
     IRDominatorTree* findOrCreateDominatorTree(IRGlobalValueWithCode* func);
+
     void invalidateAnalysisForInst(IRGlobalValueWithCode* func)
     {
         m_mapInstToAnalysis.remove(func);
@@ -2143,10 +2193,7 @@ private:
     IRModule() = delete;
 
     /// Ctor
-    IRModule(Session* session)
-        : m_session(session), m_memoryArena(kMemoryArenaBlockSize), m_deduplicationContext(this)
-    {
-    }
+    IRModule(Session* session);
 
     // The compilation session in use.
     Session* m_session = nullptr;
@@ -2170,6 +2217,10 @@ private:
     /// are allocated.
     MemoryArena m_memoryArena;
 
+    /// The session's pool that `m_memoryArena` was acquired from, and is released to when the
+    /// module is destroyed.
+    RefPtr<MemoryArenaPool> m_memoryArenaPool;
+
     /// A pool to allow reuse of common types of containers to reduce memory allocations
     /// and rehashing.
     ContainerPool m_containerPool;
@@ -2182,7 +2233,15 @@ private:
 
     Dictionary<IRInst*, IRAnalysis> m_mapInstToAnalysis;
 
-    Dictionary<ImmutableHashedString, List<IRInst*>> m_mapMangledNameToGlobalInst;
+    Dictionary<
+        ImmutableHashedString,
+        List<IRInst*>,
+        ImmutableHashedStringHash,
+        ImmutableHashedStringEqual>
+        m_mapMangledNameToGlobalInst;
+
+    RefPtr<RefObject> m_linkInfo;
+    std::mutex m_linkInfoMutex;
 
     /// Hold a mapping for inst -> uniqueID. This mapping is generated on
     /// demand if passes need them, rather than eagerly storing them on
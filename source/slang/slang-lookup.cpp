@@ -850,6 +850,35 @@ static bool _isDeclOverloadable(Decl* decl)
     return false;
 }
 
+static thread_local ScopedLookupStats gScopedLookupStats;
+
+ScopedLookupStats& getScopedLookupStats()
+{
+    return gScopedLookupStats;
+}
+
+/// Can lookup of `name` in the non-type scope `containerDecl` be skipped entirely?
+///
+/// Most identifiers are declared in only one of the scopes that lookup walks
+/// through, so most visits are misses. For a scope that isn't a type or an
+/// `extension`, lookup only ever finds direct or transparent members, and a
+/// miss can be decided from the container's member dictionary alone, without
+/// forming a specialized reference to the container first.
+///
+static bool _isKnownMissInNonTypeContainer(
+    ContainerDecl* containerDecl,
+    Name* name,
+    LookupRequest const& request)
+{
+    if (request.isCompletionRequest())
+        return false;
+    if (as<AggTypeDeclBase>(containerDecl))
+        return false;
+    if (containerDecl->findLastDirectMemberDeclOfName(name))
+        return false;
+    return containerDecl->getTransparentDirectMemberDecls().getCount() == 0;
+}
+
 static void _lookUpInScopes(
     ASTBuilder* astBuilder,
     Name* name,
@@ -865,6 +894,9 @@ static void _lookUpInScopes(
     // The file decl that this scope is in.
     FileDecl* thisFileDecl = nullptr;
 
+    auto& stats = getScopedLookupStats();
+    stats.lookupCount++;
+
     for (; scope != endScope; scope = scope->parent)
     {
         // Note that we consider all "peer" scopes together,
@@ -895,16 +927,23 @@ static void _lookUpInScopes(
                 }
             }
 
+            stats.containerCount++;
+            const bool isKnownMiss = _isKnownMissInNonTypeContainer(containerDecl, name, request);
+
             // TODO: If we need default substitutions to be applied to
             // the `containerDecl`, then it might make sense to have
             // each `link` in the scope store a decl-ref instead of
             // just a decl.
             //
-            DeclRef<ContainerDecl> containerDeclRef = createDefaultSubstitutionsIfNeeded(
-                                                          astBuilder,
-                                                          request.semantics,
-                                                          makeDeclRef(containerDecl))
-                                                          .as<ContainerDecl>();
+            DeclRef<ContainerDecl> containerDeclRef;
+            if (!isKnownMiss)
+            {
+                containerDeclRef = createDefaultSubstitutionsIfNeeded(
+                                       astBuilder,
+                                       request.semantics,
+                                       makeDeclRef(containerDecl))
+                                       .as<ContainerDecl>();
+            }
 
             // If the container we are looking into represents a type
             // or an `extension` of a type, then we need to treat
@@ -915,7 +954,11 @@ static void _lookUpInScopes(
             // Note: The `AggTypeDeclBase` class is the common superclass
             // between `AggTypeDecl` and `ExtensionDecl`.
             //
-            if (auto aggTypeDeclBaseRef = containerDeclRef.as<AggTypeDeclBase>())
+            if (isKnownMiss)
+            {
+                stats.skippedContainerCount++;
+            }
+            else if (auto aggTypeDeclBaseRef = containerDeclRef.as<AggTypeDeclBase>())
             {
                 // When reconstructing the final expression for a result
                 // looked up through the type or extension, we will need
@@ -1050,14 +1093,14 @@ static void _lookUpInScopes(
             // of some nested type, then there shouldn't be an implicit `this`
             // expression for the outer type, but instead an implicit `This`.
             //
-            if (containerDeclRef.is<ConstructorDecl>())
+            if (as<ConstructorDecl>(containerDecl))
             {
                 // In the context of an `__init` declaration, the members of
                 // the surrounding type are accessible through a mutable `this`.
                 //
                 thisParameterMode = LookupResultItem::Breadcrumb::ThisParameterMode::MutableValue;
             }
-            else if (containerDeclRef.is<SetterDecl>())
+            else if (as<SetterDecl>(containerDecl))
             {
                 // In the context of a `set` accessor, the members of the
                 // surrounding type are accessible through a mutable `this`.
@@ -1069,19 +1112,19 @@ static void _lookUpInScopes(
                 //
                 thisParameterMode = LookupResultItem::Breadcrumb::ThisParameterMode::MutableValue;
             }
-            else if (auto funcDeclRef = containerDeclRef.as<FunctionDeclBase>())
+            else if (auto funcDecl = as<FunctionDeclBase>(containerDecl))
             {
                 // The implicit `this`/`This` for a function-like declaration
                 // depends on modifiers attached to the declaration.
                 //
-                if (isEffectivelyStatic(funcDeclRef.getDecl()))
+                if (isEffectivelyStatic(funcDecl))
                 {
                     // A `static` method only has access to an implicit `This`,
                     // and does not have a `this` expression available.
                     //
                     thisParameterMode = LookupResultItem::Breadcrumb::ThisParameterMode::Type;
                 }
-                else if (funcDeclRef.getDecl()->hasModifier<MutatingAttribute>())
+                else if (funcDecl->hasModifier<MutatingAttribute>())
                 {
                     // In a non-`static` method marked `[mutating]` there is
                     // an implicit `this` parameter that is mutable.
@@ -1089,7 +1132,7 @@ static void _lookUpInScopes(
                     thisParameterMode =
                         LookupResultItem::Breadcrumb::ThisParameterMode::MutableValue;
                 }
-                else if (funcDeclRef.getDecl()->hasModifier<RefAttribute>())
+                else if (funcDecl->hasModifier<RefAttribute>())
                 {
                     // In a non-`static` method marked `[ref]` there is
                     // an implicit `this` parameter that is mutable.
@@ -1106,7 +1149,7 @@ static void _lookUpInScopes(
                         LookupResultItem::Breadcrumb::ThisParameterMode::ImmutableValue;
                 }
             }
-            else if (containerDeclRef.as<AggTypeDeclBase>())
+            else if (as<AggTypeDeclBase>(containerDecl))
             {
                 // When lookup moves from a nested typed declaration to an
                 // outer scope, there is no ability to use an implicit `this`
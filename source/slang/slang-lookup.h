@@ -56,6 +56,23 @@ QualType getTypeForDeclRef(
 
 QualType getTypeForDeclRef(ASTBuilder* astBuilder, DeclRef<Decl> declRef, SourceLoc loc);
 
+/// Counters for lookup through scopes, reported by `-report-perf-benchmark`.
+struct ScopedLookupStats
+{
+    /// Number of identifiers looked up through a scope chain.
+    UInt64 lookupCount = 0;
+
+    /// Number of container declarations visited by those lookups.
+    UInt64 containerCount = 0;
+
+    /// Number of visited containers that were skipped because they
+    /// have no members with the name being looked up.
+    UInt64 skippedContainerCount = 0;
+};
+
+/// Get the lookup counters for the current thread.
+ScopedLookupStats& getScopedLookupStats();
+
 /// Add a found item to a lookup result
 void AddToLookupResult(LookupResult& result, LookupResultItem item);
 void AddToLookupResult(LookupResult& result, const LookupResult& items);
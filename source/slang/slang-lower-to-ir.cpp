@@ -6,6 +6,7 @@
 #include "../core/slang-performance-profiler.h"
 #include "../core/slang-random-generator.h"
 #include "slang-check.h"
+#include "slang-decl-cost-report.h"
 #include "slang-ir-autodiff.h"
 #include "slang-ir-bit-field-accessors.h"
 #include "slang-ir-check-differentiability.h"
@@ -28,6 +29,7 @@
 #include "slang-ir-obfuscate-loc.h"
 #include "slang-ir-operator-shift-overflow.h"
 #include "slang-ir-peephole.h"
+#include "slang-ir-redundancy-removal.h"
 #include "slang-ir-sccp.h"
 #include "slang-ir-simplify-cfg.h"
 #include "slang-ir-ssa.h"
@@ -501,6 +503,12 @@ struct SharedIRGenContext
     // prelink into the current module after lowering.
     List<IRInst*> externalSymbolsToPrelink;
 
+    // Where to record the time spent lowering each declaration, if anywhere.
+    DeclCostReport* declCostReport = nullptr;
+    // Time spent in `lowerDecl` calls nested inside the one currently being timed, so that each
+    // declaration is only charged for its own time.
+    std::chrono::nanoseconds nestedLoweringTime = std::chrono::nanoseconds::zero();
+
     void setGlobalValue(Decl* decl, LoweredValInfo value)
     {
         globalEnv.mapDeclToValue[decl] = value;
@@ -12398,7 +12406,26 @@ LoweredValInfo ensureDecl(IRGenContext* context, Decl* decl)
     subContext.irBuilder = &subIRBuilder;
     subContext.env = &subEnv;
 
-    auto result = lowerDecl(&subContext, decl);
+    LoweredValInfo result;
+    if (auto declCostReport = context->shared->declCostReport)
+    {
+        auto& nestedLoweringTime = context->shared->nestedLoweringTime;
+        const auto outerNestedTime = nestedLoweringTime;
+        nestedLoweringTime = std::chrono::nanoseconds::zero();
+
+        const auto startTime = std::chrono::high_resolution_clock::now();
+        result = lowerDecl(&subContext, decl);
+        const auto elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+
+        declCostReport->addLoweringTime(
+            decl,
+            std::chrono::duration<double>(elapsedTime - nestedLoweringTime).count());
+        nestedLoweringTime = outerNestedTime + elapsedTime;
+    }
+    else
+    {
+        result = lowerDecl(&subContext, decl);
+    }
 
     // By default assume that any value we are lowering represents
     // something that should be installed globally.
@@ -12822,9 +12849,25 @@ static void lowerProgramEntryPointToIR(
     stripFrontEndOnlyInstructions(builder->getModule(), IRStripOptions());
 }
 
+/// Is `decl` a function whose body was never checked?
+///
+/// With `-lazy-function-body-checking`, functions that nothing reachable refers to
+/// keep their unparsed body, and must not be lowered.
+///
+static bool isUncheckedFuncDecl(Decl* decl)
+{
+    if (auto genericDecl = as<GenericDecl>(decl))
+        decl = genericDecl->inner;
+    auto funcDecl = as<FunctionDeclBase>(decl);
+    return funcDecl && as<UnparsedStmt>(funcDecl->body);
+}
+
 /// Ensure that `decl` and all relevant declarations under it get emitted.
 static void ensureAllDeclsRec(IRGenContext* context, Decl* decl)
 {
+    if (isUncheckedFuncDecl(decl))
+        return;
+
     ensureDecl(context, decl);
 
     // Note: We are checking here for aggregate type declarations, and
@@ -12881,6 +12924,7 @@ RefPtr<IRModule> generateIRForTranslationUnit(
         translationUnit->getModuleDecl(),
         translationUnit->compileRequest->getLinkage());
     SharedIRGenContext* sharedContext = &sharedContextStorage;
+    sharedContext->declCostReport = linkage->getDeclCostReport();
 
     IRGenContext contextStorage(sharedContext, astBuilder);
     IRGenContext* context = &contextStorage;
@@ -12922,23 +12966,31 @@ RefPtr<IRModule> generateIRForTranslationUnit(
     // For now, we will assume that *all* global-scope declarations
     // represent public/exported symbols.
 
+    // The lowering loops are profiled separately from the mandatory passes that follow.
+
     // First, ensure that all entry points have been emitted,
     // in case they require special handling.
-    for (auto entryPoint : translationUnit->getEntryPoints())
     {
-        List<SourceFile*> sources = translationUnit->getSourceFiles();
-        SourceFile* source = sources.getFirst();
-        PathInfo pInfo = source->getPathInfo();
-        String path = pInfo.getMostUniqueIdentity();
-        lowerFrontEndEntryPointToIR(context, entryPoint, Path::getFileNameWithoutExt(path));
+        SLANG_PROFILE_SECTION(lowerEntryPointsToIR);
+        for (auto entryPoint : translationUnit->getEntryPoints())
+        {
+            List<SourceFile*> sources = translationUnit->getSourceFiles();
+            SourceFile* source = sources.getFirst();
+            PathInfo pInfo = source->getPathInfo();
+            String path = pInfo.getMostUniqueIdentity();
+            lowerFrontEndEntryPointToIR(context, entryPoint, Path::getFileNameWithoutExt(path));
+        }
     }
 
     //
     // Next, ensure that all other global declarations have
     // been emitted.
-    for (auto decl : translationUnit->getModuleDecl()->getDirectMemberDecls())
     {
-        ensureAllDeclsRec(context, decl);
+        SLANG_PROFILE_SECTION(lowerGlobalDeclsToIR);
+        for (auto decl : translationUnit->getModuleDecl()->getDirectMemberDecls())
+        {
+            ensureAllDeclsRec(context, decl);
+        }
     }
 
     // Build a global instruction to hold all the string
@@ -13150,6 +13202,49 @@ RefPtr<IRModule> generateIRForTranslationUnit(
         }
     }
 
+    // When requested, run a round of target-independent optimization
+    // over the module before it is stripped and serialized, so that
+    // every later link against this module starts from simplified
+    // function bodies instead of redoing the same work per target.
+    //
+    // We only touch non-generic functions (generic bodies will be
+    // specialized and simplified after linking anyway), and only use
+    // passes that don't depend on a target or on other modules, so
+    // the result stays valid for any target the module is linked for.
+    // In particular, the peephole pass runs in its prelinking mode, so
+    // that it doesn't fold lookups into witness tables that another
+    // module may still provide at link time.
+    //
+    if (!minimumOptimizations &&
+        linkage->m_optionSet.getBoolOption(CompilerOptionName::PreoptimizeModuleIR) &&
+        compileRequest->getSink()->getErrorCount() == 0)
+    {
+        SLANG_PROFILE_SECTION(preoptimizeModuleIR);
+
+        const int kMaxIterationCount = 8;
+        auto peepholeOptions = PeepholeOptimizationOptions::getPrelinking();
+        for (auto inst : module->getGlobalInsts())
+        {
+            auto func = as<IRFunc>(inst);
+            if (!func || !func->getFirstBlock())
+                continue;
+
+            for (int iteration = 0; iteration < kMaxIterationCount; ++iteration)
+            {
+                bool changed = applySparseConditionalConstantPropagation(
+                    func,
+                    nullptr,
+                    compileRequest->getSink());
+                changed |= peepholeOptimize(nullptr, func, peepholeOptions);
+                changed |= simplifyCFG(func, CFGSimplificationOptions::getDefault());
+                changed |= removeRedundancyInFunc(func, false);
+                eliminateDeadCode(func, dceOptions);
+                if (!changed)
+                    break;
+            }
+        }
+    }
+
     // The "mandatory" optimization passes may make use of the
     // `IRHighLevelDeclDecoration` type to relate IR instructions
     // back to AST-level code in order to improve the quality
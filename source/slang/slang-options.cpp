@@ -542,6 +542,13 @@ void initCommandOptions(CommandOptions& options)
          "-report-dynamic-dispatch-sites",
          nullptr,
          "Reports information about dynamic dispatch sites for interface calls."},
+        {OptionKind::ReportDeclarationCosts,
+         "-report-decl-costs",
+         nullptr,
+         "Reports the compile time cost of source declarations: the time spent lowering each one "
+         "to IR, and the number of IR instructions each one accounts for in the code that is "
+         "generated (after linking, specialization and inlining). Through the API, the report "
+         "is returned by ISession::getDeclarationCostReport."},
         {OptionKind::SkipSPIRVValidation,
          "-skip-spirv-validation",
          nullptr,
@@ -589,6 +596,11 @@ void initCommandOptions(CommandOptions& options)
          "-reflection-json",
          "-reflection-json <path>",
          "Emit reflection data in JSON format to a file."},
+        {OptionKind::EmitReflectionBinary,
+         "-reflection-binary",
+         "-reflection-binary <path>",
+         "Emit reflection data in a compact, memory-mappable binary format to a file. The "
+         "format is internal to Slang tools and can change between releases."},
         {OptionKind::UseMSVCStyleBitfieldPacking,
          "-msvc-style-bitfield-packing",
          nullptr,
@@ -855,6 +867,27 @@ void initCommandOptions(CommandOptions& options)
          "existing compiler <compiler>.\n"
          "These are intended for debugging/testing purposes, when you want to be able to see what "
          "these existing compilers do with the \"same\" input and options"},
+        {OptionKind::PrecompiledPreludeCachePath,
+         "-precompiled-prelude-cache",
+         "-precompiled-prelude-cache <path>",
+         "Build a precompiled header from the C++ prelude in the directory <path>, and use it "
+         "when compiling generated C++ with gcc or clang. The header is rebuilt whenever the "
+         "prelude, the compiler or the options that affect it change. A header that fails to "
+         "build is not retried until one of them changes."},
+        {OptionKind::DownstreamCompileCachePath,
+         "-downstream-compile-cache",
+         "-downstream-compile-cache <path>",
+         "Cache the results of downstream compilers in the directory <path>. A compilation with "
+         "the same source, compiler version and options as a cached one reuses its output and "
+         "diagnostics instead of running the compiler."},
+        {OptionKind::DownstreamJobCount,
+         "-downstream-jobs",
+         "-downstream-jobs <count>",
+         "Run up to <count> downstream compilations in the background, whilst code is generated "
+         "for the remaining entry points and targets. Only compilers that can safely run more "
+         "than once at a time (DXC, FXC, and compilers that run as a separate process) are run "
+         "in the background. Their diagnostics are reported, in the order the compilations "
+         "were started, after Slang's own diagnostics for all of the entry points and targets."},
     };
 
     _addOptions(makeConstArrayView(downstreamOpts), options);
@@ -944,6 +977,12 @@ void initCommandOptions(CommandOptions& options)
          "-validate-ir-detailed",
          nullptr,
          "Perform debug validation on IR after each intermediate pass."},
+        {OptionKind::SpecializeFullSweep,
+         "-specialize-full-sweep",
+         nullptr,
+         "Revisit the whole module in every sweep of IR specialization, rather than only what the "
+         "previous sweep changed. This is slower, and is meant for checking that the incremental "
+         "sweeps find the same specializations."},
         {OptionKind::DumpIRBefore,
          "-dump-ir-before",
          "-dump-ir-before <pass-names>",
@@ -1082,6 +1121,18 @@ void initCommandOptions(CommandOptions& options)
          "-loop-inversion",
          nullptr,
          "Enable loop inversion in the code-gen optimization. Default is off"},
+        {OptionKind::PreoptimizeModuleIR,
+         "-preoptimize-module-ir",
+         nullptr,
+         "Run target-independent optimizations on the IR of non-generic functions when a module "
+         "is checked, so that the serialized module carries the optimized IR. Default is off"},
+        {OptionKind::LazyFunctionBodyChecking,
+         "-lazy-function-body-checking",
+         nullptr,
+         "Skip semantic checking and IR generation for non-public module-scope functions that "
+         "are not referenced from the rest of the module or requested as entry points. "
+         "Diagnostics in skipped function bodies are not reported. Modules loaded through "
+         "ISession are always checked in full. Default is off"},
         {OptionKind::GenerateWholeProgram,
          "-whole-program",
          nullptr,
@@ -2378,6 +2429,8 @@ SlangResult OptionsParser::_parse(int argc, char const* const* argv)
         case OptionKind::ReportPerfBenchmark:
         case OptionKind::ReportCheckpointIntermediates:
         case OptionKind::ReportDynamicDispatchSites:
+        case OptionKind::ReportDeclarationCosts:
+        case OptionKind::SpecializeFullSweep:
         case OptionKind::SkipSPIRVValidation:
         case OptionKind::DisableSpecialization:
         case OptionKind::DisableDynamicDispatch:
@@ -2406,6 +2459,8 @@ SlangResult OptionsParser::_parse(int argc, char const* const* argv)
         case OptionKind::NoHLSLBinding:
         case OptionKind::NoHLSLPackConstantBufferElements:
         case OptionKind::LoopInversion:
+        case OptionKind::PreoptimizeModuleIR:
+        case OptionKind::LazyFunctionBodyChecking:
         case OptionKind::UnscopedEnum:
         case OptionKind::PreserveParameters:
         case OptionKind::UseMSVCStyleBitfieldPacking:
@@ -3051,6 +3106,43 @@ SlangResult OptionsParser::_parse(int argc, char const* const* argv)
                 linkage->m_optionSet.set(CompilerOptionName::EmitReflectionJSON, outputPath.value);
                 break;
             }
+        case OptionKind::PrecompiledPreludeCachePath:
+            {
+                CommandLineArg cachePath;
+                SLANG_RETURN_ON_FAIL(m_reader.expectArg(cachePath));
+
+                linkage->m_optionSet.set(
+                    CompilerOptionName::PrecompiledPreludeCachePath,
+                    cachePath.value);
+                break;
+            }
+        case OptionKind::DownstreamCompileCachePath:
+            {
+                CommandLineArg cachePath;
+                SLANG_RETURN_ON_FAIL(m_reader.expectArg(cachePath));
+
+                linkage->m_optionSet.set(
+                    CompilerOptionName::DownstreamCompileCachePath,
+                    cachePath.value);
+                break;
+            }
+        case OptionKind::DownstreamJobCount:
+            {
+                Int jobCount = 0;
+                SLANG_RETURN_ON_FAIL(_expectUInt(arg, jobCount));
+                linkage->m_optionSet.set(CompilerOptionName::DownstreamJobCount, (int)jobCount);
+                break;
+            }
+        case OptionKind::EmitReflectionBinary:
+            {
+                CommandLineArg outputPath;
+                SLANG_RETURN_ON_FAIL(m_reader.expectArg(outputPath));
+
+                linkage->m_optionSet.set(
+                    CompilerOptionName::EmitReflectionBinary,
+                    outputPath.value);
+                break;
+            }
         case OptionKind::DepFile:
             {
                 CommandLineArg dependencyPath;
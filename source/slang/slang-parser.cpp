@@ -9025,6 +9025,24 @@ void parseSourceFile(
         translationUnit->compileRequest->getLinkage()->isInLanguageServer();
     options.optionSet = translationUnit->compileRequest->optionSet;
 
+    // Lazy function body checking decides which functions are reachable by
+    // looking at which names are used, so we count identifiers here, where
+    // we see the tokens after preprocessing.
+    //
+    if (options.optionSet.getBoolOption(CompilerOptionName::LazyFunctionBodyChecking))
+    {
+        auto namePool = translationUnit->getNamePool();
+        for (const auto& token : tokens)
+        {
+            if (token.type != TokenType::Identifier)
+                continue;
+            Name* name = token.getNameOrNull();
+            if (!name)
+                name = namePool->getName(token.getContent());
+            translationUnit->identifierTokenCounts[name]++;
+        }
+    }
+
     Parser parser(astBuilder, tokens, sink, outerScope, options);
     parser.namePool = translationUnit->getNamePool();
     parser.sourceLanguage = sourceLanguage;
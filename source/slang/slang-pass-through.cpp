@@ -277,5 +277,30 @@ SlangResult passthroughDownstreamDiagnostics(
     return SLANG_OK;
 }
 
+SlangResult finishDownstreamCompile(
+    DiagnosticSink* sink,
+    IDownstreamCompiler* compiler,
+    SlangResult compileResult,
+    IArtifact* sourceArtifact,
+    IArtifact* artifact)
+{
+    // Extract diagnostics regardless of compile result
+    SLANG_RETURN_ON_FAIL(passthroughDownstreamDiagnostics(sink, compiler, artifact));
+
+    // Now check if compile failed
+    SLANG_RETURN_ON_FAIL(compileResult);
+
+    // Copy over all of the information associated with the source into the output
+    if (sourceArtifact)
+    {
+        for (auto associatedArtifact : sourceArtifact->getAssociated())
+        {
+            artifact->addAssociated(associatedArtifact);
+        }
+    }
+
+    return SLANG_OK;
+}
+
 
 } // namespace Slang
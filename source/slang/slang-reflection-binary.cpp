@@ -0,0 +1,267 @@
+// slang-reflection-binary.cpp
+#include "slang-reflection-binary.h"
+
+#include "../core/slang-blob-builder.h"
+#include "slang-serialize-fossil.h"
+#include "slang-serialize.h"
+
+namespace Slang
+{
+
+//
+// Serialization of the binary reflection tables.
+//
+// The order of the fields in each `serialize()` function must
+// match the order of the fields in the corresponding `Fossilized_*`
+// declaration in `slang-reflection-binary.h`.
+//
+
+template<typename S>
+void serialize(S const& serializer, BinaryReflectionBinding& value)
+{
+    SLANG_SCOPED_SERIALIZER_STRUCT(serializer);
+    serialize(serializer, value.category);
+    serialize(serializer, value.space);
+    serialize(serializer, value.offset);
+}
+
+template<typename S>
+void serialize(S const& serializer, BinaryReflectionVariable& value)
+{
+    SLANG_SCOPED_SERIALIZER_STRUCT(serializer);
+    serialize(serializer, value.name);
+    serialize(serializer, value.typeLayout);
+    serialize(serializer, value.semanticName);
+    serialize(serializer, value.semanticIndex);
+    serialize(serializer, value.bindings);
+}
+
+template<typename S>
+void serialize(S const& serializer, BinaryReflectionTypeSize& value)
+{
+    SLANG_SCOPED_SERIALIZER_STRUCT(serializer);
+    serialize(serializer, value.category);
+    serialize(serializer, value.alignment);
+    serialize(serializer, value.size);
+    serialize(serializer, value.stride);
+}
+
+template<typename S>
+void serialize(S const& serializer, BinaryReflectionTypeLayout& value)
+{
+    SLANG_SCOPED_SERIALIZER_STRUCT(serializer);
+    serialize(serializer, value.name);
+    serialize(serializer, value.kind);
+    serialize(serializer, value.scalarType);
+    serialize(serializer, value.rowCount);
+    serialize(serializer, value.columnCount);
+    serialize(serializer, value.elementCount);
+    serialize(serializer, value.elementTypeLayout);
+    serialize(serializer, value.fields);
+    serialize(serializer, value.sizes);
+}
+
+template<typename S>
+void serialize(S const& serializer, BinaryReflectionEntryPoint& value)
+{
+    SLANG_SCOPED_SERIALIZER_STRUCT(serializer);
+    serialize(serializer, value.name);
+    serialize(serializer, value.stage);
+    serialize(serializer, value.threadGroupSizeX);
+    serialize(serializer, value.threadGroupSizeY);
+    serialize(serializer, value.threadGroupSizeZ);
+    serialize(serializer, value.parameters);
+    serialize(serializer, value.result);
+}
+
+template<typename S>
+void serialize(S const& serializer, BinaryReflection& value)
+{
+    SLANG_SCOPED_SERIALIZER_STRUCT(serializer);
+    serialize(serializer, value.version);
+    serialize(serializer, value.bindlessSpaceIndex);
+    serialize(serializer, value.parameters);
+    serialize(serializer, value.entryPoints);
+    serialize(serializer, value.variables);
+    serialize(serializer, value.typeLayouts);
+}
+
+//
+// Building the tables from the reflection API.
+//
+
+namespace
+{ // anonymous
+
+struct BinaryReflectionBuilder
+{
+    BinaryReflection reflection;
+
+    // Type layouts are shared between variables, so we only add each one once.
+    Dictionary<slang::TypeLayoutReflection*, Int32> mapTypeLayoutToIndex;
+
+    static String getString(char const* text) { return text ? String(text) : String(); }
+
+    Int32 addTypeLayout(slang::TypeLayoutReflection* typeLayout)
+    {
+        if (!typeLayout)
+            return -1;
+
+        if (auto found = mapTypeLayoutToIndex.tryGetValue(typeLayout))
+            return *found;
+
+        // Reserve the slot before visiting anything the layout refers to,
+        // so that recursive types (e.g. through pointers) terminate.
+        const Int32 index = Int32(reflection.typeLayouts.getCount());
+        reflection.typeLayouts.add(BinaryReflectionTypeLayout());
+        mapTypeLayoutToIndex.add(typeLayout, index);
+
+        BinaryReflectionTypeLayout info;
+        info.kind = UInt32(typeLayout->getKind());
+
+        if (auto type = typeLayout->getType())
+        {
+            ComPtr<ISlangBlob> nameBlob;
+            if (SLANG_SUCCEEDED(type->getFullName(nameBlob.writeRef())))
+            {
+                info.name = String(
+                    (char const*)nameBlob->getBufferPointer(),
+                    (char const*)nameBlob->getBufferPointer() + nameBlob->getBufferSize());
+            }
+            info.scalarType = UInt32(type->getScalarType());
+            info.rowCount = type->getRowCount();
+            info.columnCount = type->getColumnCount();
+        }
+
+        switch (typeLayout->getKind())
+        {
+        case slang::TypeReflection::Kind::Array:
+        case slang::TypeReflection::Kind::Vector:
+            info.elementCount = UInt64(typeLayout->getElementCount());
+            break;
+        default:
+            break;
+        }
+
+        info.elementTypeLayout = addTypeLayout(typeLayout->getElementTypeLayout());
+
+        if (typeLayout->getKind() == slang::TypeReflection::Kind::Struct)
+        {
+            const unsigned fieldCount = typeLayout->getFieldCount();
+            for (unsigned ff = 0; ff < fieldCount; ++ff)
+            {
+                info.fields.add(addVariable(typeLayout->getFieldByIndex(ff)));
+            }
+        }
+
+        const unsigned categoryCount = typeLayout->getCategoryCount();
+        for (unsigned cc = 0; cc < categoryCount; ++cc)
+        {
+            auto category = SlangParameterCategory(typeLayout->getCategoryByIndex(cc));
+
+            BinaryReflectionTypeSize size;
+            size.category = UInt32(category);
+            size.alignment = typeLayout->getAlignment(category);
+            size.size = UInt64(typeLayout->getSize(category));
+            size.stride = UInt64(typeLayout->getStride(category));
+            info.sizes.add(size);
+        }
+
+        reflection.typeLayouts[index] = info;
+        return index;
+    }
+
+    Int32 addVariable(slang::VariableLayoutReflection* varLayout)
+    {
+        if (!varLayout)
+            return -1;
+
+        BinaryReflectionVariable info;
+        info.name = getString(varLayout->getName());
+        info.typeLayout = addTypeLayout(varLayout->getTypeLayout());
+        info.semanticName = getString(varLayout->getSemanticName());
+        info.semanticIndex = UInt32(varLayout->getSemanticIndex());
+
+        const unsigned categoryCount = varLayout->getCategoryCount();
+        for (unsigned cc = 0; cc < categoryCount; ++cc)
+        {
+            auto category = SlangParameterCategory(varLayout->getCategoryByIndex(cc));
+
+            BinaryReflectionBinding binding;
+            binding.category = UInt32(category);
+            binding.space = UInt32(varLayout->getBindingSpace(category));
+            binding.offset = UInt64(varLayout->getOffset(category));
+            info.bindings.add(binding);
+        }
+
+        const Int32 index = Int32(reflection.variables.getCount());
+        reflection.variables.add(info);
+        return index;
+    }
+
+    void addEntryPoint(slang::EntryPointReflection* entryPoint)
+    {
+        BinaryReflectionEntryPoint info;
+        info.name = getString(entryPoint->getName());
+        info.stage = UInt32(entryPoint->getStage());
+
+        if (entryPoint->getStage() == SLANG_STAGE_COMPUTE)
+        {
+            SlangUInt threadGroupSize[3] = {0, 0, 0};
+            entryPoint->getComputeThreadGroupSize(3, threadGroupSize);
+            info.threadGroupSizeX = UInt32(threadGroupSize[0]);
+            info.threadGroupSizeY = UInt32(threadGroupSize[1]);
+            info.threadGroupSizeZ = UInt32(threadGroupSize[2]);
+        }
+
+        const unsigned parameterCount = entryPoint->getParameterCount();
+        for (unsigned pp = 0; pp < parameterCount; ++pp)
+        {
+            info.parameters.add(addVariable(entryPoint->getParameterByIndex(pp)));
+        }
+
+        info.result = addVariable(entryPoint->getResultVarLayout());
+
+        reflection.entryPoints.add(info);
+    }
+
+    void build(slang::ProgramLayout* programLayout)
+    {
+        const unsigned parameterCount = programLayout->getParameterCount();
+        for (unsigned pp = 0; pp < parameterCount; ++pp)
+        {
+            reflection.parameters.add(addVariable(programLayout->getParameterByIndex(pp)));
+        }
+
+        const SlangUInt entryPointCount = programLayout->getEntryPointCount();
+        for (SlangUInt ee = 0; ee < entryPointCount; ++ee)
+        {
+            addEntryPoint(programLayout->getEntryPointByIndex(ee));
+        }
+
+        reflection.bindlessSpaceIndex = Int32(programLayout->getBindlessSpaceIndex());
+    }
+};
+
+} // namespace
+
+SlangResult writeBinaryReflection(slang::ProgramLayout* programLayout, ISlangBlob** outBlob)
+{
+    if (!programLayout || !outBlob)
+        return SLANG_E_INVALID_ARG;
+
+    BinaryReflectionBuilder builder;
+    builder.build(programLayout);
+
+    BlobBuilder blobBuilder;
+    {
+        Fossil::SerialWriter writer(blobBuilder);
+        Serializer<Fossil::SerialWriter, void> serializer(&writer);
+        serialize(serializer, builder.reflection);
+    }
+
+    blobBuilder.writeToBlob(outBlob);
+    return SLANG_OK;
+}
+
+} // namespace Slang
@@ -0,0 +1,249 @@
+// slang-reflection-binary.h
+#ifndef SLANG_REFLECTION_BINARY_H
+#define SLANG_REFLECTION_BINARY_H
+
+//
+// This file defines a compact binary form of the reflection
+// information for a program, stored in the fossil format
+// (see `slang-fossil.h`).
+//
+// Where `emitReflectionJSON()` produces text that must be parsed
+// again by the consumer, the binary form is a small set of flat
+// tables (parameters, entry points, variables and type layouts)
+// that refer to one another by index. A consumer can memory-map
+// the blob and navigate it in place through the `Fossilized_*`
+// declarations below, without a live session or `ProgramLayout`.
+//
+// Tools built against the Slang source tree can read the data
+// without creating a session. The header isn't installed, and the
+// layout can change between releases, which is what the version
+// number in the root is for.
+//
+
+#include "slang-fossil.h"
+#include "slang.h"
+
+namespace Slang
+{
+
+/// Binding of a variable for a single parameter category.
+struct BinaryReflectionBinding
+{
+    /// The `SlangParameterCategory` the binding is for.
+    UInt32 category = 0;
+
+    /// Register space/set of the binding.
+    UInt32 space = 0;
+
+    /// Offset (register, binding index, or byte offset for uniform data).
+    UInt64 offset = 0;
+};
+
+/// A variable layout: a parameter, field, or entry-point parameter/result.
+struct BinaryReflectionVariable
+{
+    String name;
+
+    /// Index into `BinaryReflection::typeLayouts`, or -1.
+    Int32 typeLayout = -1;
+
+    /// Binding semantic (for varying parameters), may be empty.
+    String semanticName;
+    UInt32 semanticIndex = 0;
+
+    List<BinaryReflectionBinding> bindings;
+};
+
+/// Size information for a type layout in a single parameter category.
+struct BinaryReflectionTypeSize
+{
+    /// The `SlangParameterCategory` the size is for.
+    UInt32 category = 0;
+    Int32 alignment = 0;
+
+    /// `SLANG_UNBOUNDED_SIZE` and `SLANG_UNKNOWN_SIZE` are stored as is.
+    UInt64 size = 0;
+    UInt64 stride = 0;
+};
+
+/// A type layout.
+///
+/// Type layouts are de-duplicated, so variables that share a
+/// layout refer to the same entry in `BinaryReflection::typeLayouts`.
+struct BinaryReflectionTypeLayout
+{
+    /// Full name of the type, for example `RWStructuredBuffer<float>`.
+    String name;
+
+    /// The `slang::TypeReflection::Kind`.
+    UInt32 kind = 0;
+
+    /// The `slang::TypeReflection::ScalarType`, for scalar, vector and matrix types.
+    UInt32 scalarType = 0;
+
+    UInt32 rowCount = 0;
+    UInt32 columnCount = 0;
+
+    /// Element count for arrays and vectors.
+    UInt64 elementCount = 0;
+
+    /// Index into `BinaryReflection::typeLayouts` of the element type of an
+    /// array, vector, matrix, buffer or parameter block, or -1.
+    Int32 elementTypeLayout = -1;
+
+    /// Indices into `BinaryReflection::variables` for the fields of a struct.
+    List<Int32> fields;
+
+    List<BinaryReflectionTypeSize> sizes;
+};
+
+struct BinaryReflectionEntryPoint
+{
+    String name;
+
+    /// The `SlangStage` of the entry point.
+    UInt32 stage = 0;
+
+    UInt32 threadGroupSizeX = 0;
+    UInt32 threadGroupSizeY = 0;
+    UInt32 threadGroupSizeZ = 0;
+
+    /// Indices into `BinaryReflection::variables`.
+    List<Int32> parameters;
+
+    /// Index into `BinaryReflection::variables`, or -1.
+    Int32 result = -1;
+};
+
+/// Root of the binary reflection data.
+struct BinaryReflection
+{
+    /// Bumped whenever the layout of the binary reflection data changes.
+    static const UInt32 kVersion = 1;
+
+    UInt32 version = kVersion;
+
+    Int32 bindlessSpaceIndex = -1;
+
+    /// Indices into `variables` for the global shader parameters.
+    List<Int32> parameters;
+
+    List<BinaryReflectionEntryPoint> entryPoints;
+
+    List<BinaryReflectionVariable> variables;
+    List<BinaryReflectionTypeLayout> typeLayouts;
+};
+
+//
+// The fossilized representations mirror the declarations above
+// field for field.
+//
+
+struct Fossilized_BinaryReflectionBinding : public FossilizedRecordVal
+{
+    Fossilized<UInt32> category;
+    Fossilized<UInt32> space;
+    Fossilized<UInt64> offset;
+};
+
+SLANG_DECLARE_FOSSILIZED_TYPE(BinaryReflectionBinding, Fossilized_BinaryReflectionBinding);
+
+struct Fossilized_BinaryReflectionVariable : public FossilizedRecordVal
+{
+    Fossilized<String> name;
+    Fossilized<Int32> typeLayout;
+    Fossilized<String> semanticName;
+    Fossilized<UInt32> semanticIndex;
+    Fossilized<List<BinaryReflectionBinding>> bindings;
+};
+
+SLANG_DECLARE_FOSSILIZED_TYPE(BinaryReflectionVariable, Fossilized_BinaryReflectionVariable);
+
+struct Fossilized_BinaryReflectionTypeSize : public FossilizedRecordVal
+{
+    Fossilized<UInt32> category;
+    Fossilized<Int32> alignment;
+    Fossilized<UInt64> size;
+    Fossilized<UInt64> stride;
+};
+
+SLANG_DECLARE_FOSSILIZED_TYPE(BinaryReflectionTypeSize, Fossilized_BinaryReflectionTypeSize);
+
+struct Fossilized_BinaryReflectionTypeLayout : public FossilizedRecordVal
+{
+    Fossilized<String> name;
+    Fossilized<UInt32> kind;
+    Fossilized<UInt32> scalarType;
+    Fossilized<UInt32> rowCount;
+    Fossilized<UInt32> columnCount;
+    Fossilized<UInt64> elementCount;
+    Fossilized<Int32> elementTypeLayout;
+    Fossilized<List<Int32>> fields;
+    Fossilized<List<BinaryReflectionTypeSize>> sizes;
+};
+
+SLANG_DECLARE_FOSSILIZED_TYPE(BinaryReflectionTypeLayout, Fossilized_BinaryReflectionTypeLayout);
+
+struct Fossilized_BinaryReflectionEntryPoint : public FossilizedRecordVal
+{
+    Fossilized<String> name;
+    Fossilized<UInt32> stage;
+    Fossilized<UInt32> threadGroupSizeX;
+    Fossilized<UInt32> threadGroupSizeY;
+    Fossilized<UInt32> threadGroupSizeZ;
+    Fossilized<List<Int32>> parameters;
+    Fossilized<Int32> result;
+};
+
+SLANG_DECLARE_FOSSILIZED_TYPE(BinaryReflectionEntryPoint, Fossilized_BinaryReflectionEntryPoint);
+
+struct Fossilized_BinaryReflection : public FossilizedRecordVal
+{
+    Fossilized<UInt32> version;
+    Fossilized<Int32> bindlessSpaceIndex;
+    Fossilized<List<Int32>> parameters;
+    Fossilized<List<BinaryReflectionEntryPoint>> entryPoints;
+    Fossilized<List<BinaryReflectionVariable>> variables;
+    Fossilized<List<BinaryReflectionTypeLayout>> typeLayouts;
+};
+
+SLANG_DECLARE_FOSSILIZED_TYPE(BinaryReflection, Fossilized_BinaryReflection);
+
+/// Get the root of the binary reflection data held in `data`.
+///
+/// Returns nullptr if the data isn't in the fossil format, is
+/// too small, has a root outside of it, or was written with a
+/// different version of the binary reflection layout.
+///
+inline Fossilized_BinaryReflection const* getBinaryReflection(void const* data, size_t size)
+{
+    if (!data || size < sizeof(Fossil::Header))
+        return nullptr;
+
+    auto header = reinterpret_cast<Fossil::Header const*>(data);
+    if (memcmp(header->magic, Fossil::Header::kMagic, sizeof(Fossil::Header::kMagic)) != 0)
+        return nullptr;
+    if (header->totalSizeIncludingHeader > size)
+        return nullptr;
+
+    // The root is found through a relative offset, which has to stay inside the data.
+    auto rootVariant = header->rootValue.get();
+    const uintptr_t rootOffset =
+        reinterpret_cast<uintptr_t>(rootVariant) - reinterpret_cast<uintptr_t>(data);
+    const UInt64 totalSize = header->totalSizeIncludingHeader;
+    if (!rootVariant || rootOffset < sizeof(Fossil::Header) || rootOffset > totalSize ||
+        totalSize - rootOffset < sizeof(Fossilized_BinaryReflection))
+        return nullptr;
+
+    auto root = static_cast<Fossilized_BinaryReflection const*>(rootVariant->getContentDataPtr());
+    if (root->version.get() != BinaryReflection::kVersion)
+        return nullptr;
+    return root;
+}
+
+/// Write the reflection information for `programLayout` as a fossil-format blob.
+SlangResult writeBinaryReflection(slang::ProgramLayout* programLayout, ISlangBlob** outBlob);
+
+} // namespace Slang
+
+#endif
@@ -94,9 +94,14 @@ Linkage::~Linkage()
     {
         auto globalSession = getSessionImpl();
         std::lock_guard<std::mutex> lock(globalSession->m_typeCheckingCacheMutex);
+        auto getCachedOverloadCount = [](TypeCheckingCache* cache)
+        {
+            return cache->resolvedOperatorOverloadCache.getCount() +
+                   cache->resolvedCallOverloadCache.getCount();
+        };
         if (!globalSession->m_typeCheckingCache ||
-            globalSession->getTypeCheckingCache()->resolvedOperatorOverloadCache.getCount() <
-                getTypeCheckingCache()->resolvedOperatorOverloadCache.getCount())
+            getCachedOverloadCount(globalSession->getTypeCheckingCache()) <
+                getCachedOverloadCount(getTypeCheckingCache()))
         {
             globalSession->m_typeCheckingCache = m_typeCheckingCache;
             getTypeCheckingCache()->version++;
@@ -126,6 +131,37 @@ TypeCheckingCache* Linkage::getTypeCheckingCache()
     return static_cast<TypeCheckingCache*>(m_typeCheckingCache.get());
 }
 
+DeclCostReport* Linkage::getDeclCostReport()
+{
+    if (!m_declCostReport && m_optionSet.getBoolOption(CompilerOptionName::ReportDeclarationCosts))
+    {
+        m_declCostReport = new DeclCostReport(getSourceManager(), getASTBuilder());
+    }
+    return m_declCostReport;
+}
+
+bool Linkage::takeDeclCostReport(StringBuilder& out, Count maxEntryCount)
+{
+    if (!m_declCostReport)
+        return false;
+    m_declCostReport->writeReport(out, maxEntryCount);
+    m_declCostReport->resetCosts();
+    return true;
+}
+
+SLANG_NO_THROW SlangResult SLANG_MCALL
+Linkage::getDeclarationCostReport(SlangInt maxEntryCount, ISlangBlob** outReport)
+{
+    if (!m_optionSet.getBoolOption(CompilerOptionName::ReportDeclarationCosts))
+        return SLANG_E_NOT_AVAILABLE;
+
+    StringBuilder report;
+    takeDeclCostReport(report, Count(maxEntryCount));
+
+    *outReport = StringBlob::moveCreate(report).detach();
+    return SLANG_OK;
+}
+
 void Linkage::destroyTypeCheckingCache()
 {
     m_typeCheckingCache = nullptr;
@@ -826,6 +862,151 @@ SLANG_NO_THROW slang::IModule* SLANG_MCALL Linkage::getLoadedModule(SlangInt ind
     return nullptr;
 }
 
+// Returns true if the file `sourceFile` was loaded from now has different contents.
+static bool _isSourceFileStale(ISlangFileSystemExt* fileSystem, SourceFile* sourceFile)
+{
+    // Only files that were actually read from the file system can be checked.
+    auto contentBlob = sourceFile->getContentBlob();
+    const auto& pathInfo = sourceFile->getPathInfo();
+    if (!contentBlob || !pathInfo.hasFileFoundPath())
+        return false;
+
+    ComPtr<ISlangBlob> currentBlob;
+    if (SLANG_FAILED(fileSystem->loadFile(pathInfo.foundPath.getBuffer(), currentBlob.writeRef())))
+    {
+        // The file has gone, so anything built from it is out of date.
+        return true;
+    }
+
+    return currentBlob->getBufferSize() != contentBlob->getBufferSize() ||
+           ::memcmp(
+               currentBlob->getBufferPointer(),
+               contentBlob->getBufferPointer(),
+               contentBlob->getBufferSize()) != 0;
+}
+
+SLANG_NO_THROW SlangResult SLANG_MCALL
+Linkage::invalidateStaleModules(SlangInt* outInvalidatedModuleCount, SlangInt* outKeptModuleCount)
+{
+    auto fileSystem = getFileSystemExt();
+
+    // The file system may be caching contents from when the modules were
+    // loaded, and we need to see what is there now.
+    fileSystem->clearCache();
+
+    // Find the modules that depend directly on a file that changed.
+    //
+    // Files are usually shared by several modules (through `#include`),
+    // so each file is only checked once.
+    //
+    Dictionary<SourceFile*, bool> mapFileToIsStale;
+    HashSet<Module*> staleModules;
+    for (auto module : loadedModulesList)
+    {
+        for (auto sourceFile : module->getFileDependencyList())
+        {
+            bool isStale = false;
+            if (!mapFileToIsStale.tryGetValue(sourceFile, isStale))
+            {
+                isStale = _isSourceFileStale(fileSystem, sourceFile);
+                mapFileToIsStale.add(sourceFile, isStale);
+            }
+            if (isStale)
+            {
+                staleModules.add(module);
+                break;
+            }
+        }
+    }
+
+    // A module that imports a stale module was checked against declarations
+    // that are about to be replaced, so it has to be reloaded too.
+    //
+    for (bool changed = true; changed && staleModules.getCount();)
+    {
+        changed = false;
+        for (auto module : loadedModulesList)
+        {
+            if (staleModules.contains(module))
+                continue;
+            for (auto dependency : module->getModuleDependencyList())
+            {
+                if (dependency != module && staleModules.contains(dependency))
+                {
+                    staleModules.add(module);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (staleModules.getCount())
+    {
+        // Changed files must be read again when the modules are reloaded. The
+        // old `SourceFile`s stay alive, since the old modules' source locations
+        // still refer to them.
+        //
+        for (const auto& [sourceFile, isStale] : mapFileToIsStale)
+        {
+            if (isStale)
+                getSourceManager()->unmapSourceFile(sourceFile);
+        }
+
+        List<String> stalePaths;
+        for (const auto& [path, module] : mapPathToLoadedModule)
+        {
+            if (staleModules.contains(module))
+                stalePaths.add(path);
+        }
+        for (const auto& path : stalePaths)
+            mapPathToLoadedModule.remove(path);
+
+        List<Name*> staleNames;
+        for (const auto& [name, module] : mapNameToLoadedModules)
+        {
+            if (staleModules.contains(module))
+                staleNames.add(name);
+        }
+        for (auto name : staleNames)
+            mapNameToLoadedModules.remove(name);
+
+        List<RefPtr<LoadedModule>> keptModules;
+        for (auto& module : loadedModulesList)
+        {
+            if (!staleModules.contains(module))
+                keptModules.add(module);
+        }
+        loadedModulesList.swapWith(keptModules);
+
+        // Drop the IR for the stale modules as well, so that nothing built
+        // from the old source outlives them in the linkage.
+        HashSet<IRModule*> staleIRModules;
+        for (auto module : staleModules)
+        {
+            if (auto irModule = module->getIRModule())
+                staleIRModules.add(irModule);
+        }
+        List<RefPtr<IRModule>> keptIRModules;
+        for (auto& irModule : compiledModules)
+        {
+            if (!staleIRModules.contains(irModule))
+                keptIRModules.add(irModule);
+        }
+        compiledModules.swapWith(keptIRModules);
+
+        // Cached type checking results may refer to declarations from the
+        // modules that were dropped.
+        destroyTypeCheckingCache();
+    }
+
+    if (outInvalidatedModuleCount)
+        *outInvalidatedModuleCount = staleModules.getCount();
+    if (outKeptModuleCount)
+        *outKeptModuleCount = loadedModulesList.getCount();
+    return SLANG_OK;
+}
+
 void Linkage::buildHash(DigestBuilder<SHA1>& builder, SlangInt targetIndex)
 {
     // Add the Slang compiler version to the hash
@@ -22,6 +22,7 @@
 #include "slang-compiler-fwd.h"
 #include "slang-compiler-options.h"
 #include "slang-content-assist-info.h"
+#include "slang-decl-cost-report.h"
 #include "slang-global-session.h"
 
 #include <slang.h>
@@ -172,6 +173,11 @@ public:
     virtual SLANG_NO_THROW slang::IModule* SLANG_MCALL getLoadedModule(SlangInt index) override;
     virtual SLANG_NO_THROW bool SLANG_MCALL
     isBinaryModuleUpToDate(const char* modulePath, slang::IBlob* binaryModuleBlob) override;
+    virtual SLANG_NO_THROW SlangResult SLANG_MCALL invalidateStaleModules(
+        SlangInt* outInvalidatedModuleCount,
+        SlangInt* outKeptModuleCount) override;
+    virtual SLANG_NO_THROW SlangResult SLANG_MCALL
+    getDeclarationCostReport(SlangInt maxEntryCount, ISlangBlob** outReport) override;
 
     // Updates the supplied builder with linkage-related information, which includes preprocessor
     // defines, the compiler version, and other compiler options. This is then merged with the hash
@@ -229,6 +235,14 @@ public:
 
     RefPtr<RefObject> m_typeCheckingCache = nullptr;
 
+    /// The per-declaration cost report, if `-report-decl-costs` is enabled, otherwise nullptr.
+    DeclCostReport* getDeclCostReport();
+    /// Write the costs collected since the last call to `out`, and reset them, so that the next
+    /// compile starts a new report. Returns false if nothing has been collected.
+    bool takeDeclCostReport(StringBuilder& out, Count maxEntryCount);
+
+    RefPtr<DeclCostReport> m_declCostReport;
+
     // Modules that have been dynamically loaded via `import`
     //
     // This is a list of unique modules loaded, in the order they were encountered.
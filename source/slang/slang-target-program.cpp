@@ -78,6 +78,18 @@ IArtifact* TargetProgram::_createEntryPointResult(
     return m_entryPointResults[entryPointIndex];
 }
 
+void TargetProgram::_discardResult(Int entryPointIndex)
+{
+    if (entryPointIndex < 0)
+    {
+        m_wholeProgramResult.setNull();
+    }
+    else if (entryPointIndex < m_entryPointResults.getCount())
+    {
+        m_entryPointResults[entryPointIndex].setNull();
+    }
+}
+
 IArtifact* TargetProgram::getOrCreateWholeProgramResult(DiagnosticSink* sink)
 {
     if (m_wholeProgramResult)
@@ -95,6 +95,14 @@ public:
         DiagnosticSink* sink,
         EndToEndCompileRequest* endToEndReq = nullptr);
 
+    /// Drop the result for an entry point, or for the whole program
+    /// if `entryPointIndex` is -1.
+    ///
+    /// Used when a downstream compilation that was finished after
+    /// the result was created fails.
+    ///
+    void _discardResult(Int entryPointIndex);
+
     RefPtr<IRModule> getOrCreateIRModuleForLayout(DiagnosticSink* sink);
 
     RefPtr<IRModule> getExistingIRModuleForLayout() { return m_irModuleForLayout; }
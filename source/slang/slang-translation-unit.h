@@ -78,6 +78,16 @@ public:
 
     bool isChecked = false;
 
+    /// Number of times each identifier appears in the preprocessed tokens of the source
+    /// files parsed into this translation unit.
+    ///
+    /// Only collected when `CompilerOptionName::LazyFunctionBodyChecking` is enabled.
+    Dictionary<Name*, Count> identifierTokenCounts;
+
+    /// Module-scope functions whose bodies are left unchecked (and that are not lowered to
+    /// IR), because nothing reachable from the rest of the module refers to them.
+    HashSet<Decl*> unreachableFuncDecls;
+
     Module* getModule() { return module; }
     ModuleDecl* getModuleDecl() { return module->getModuleDecl(); }
 
@@ -0,0 +1,144 @@
+// unit-test-binary-reflection.cpp
+
+#include "../../source/core/slang-io.h"
+#include "../../source/core/slang-process.h"
+#include "../../source/slang/slang-reflection-binary.h"
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+using namespace Slang;
+
+// Test that the binary reflection blob can be navigated in place, and that it
+// matches what the reflection API reports.
+
+static Fossilized_BinaryReflectionVariable const* _findVariable(
+    Fossilized_BinaryReflection const* reflection,
+    Fossilized<List<Int32>> const& indices,
+    char const* name)
+{
+    for (auto index : indices)
+    {
+        auto& variable = reflection->variables[index.get()];
+        if (variable.name.get() == UnownedStringSlice(name))
+            return &variable;
+    }
+    return nullptr;
+}
+
+SLANG_UNIT_TEST(binaryReflection)
+{
+    const char* userSourceBody = R"(
+        struct Params
+        {
+            float4 color;
+            uint count;
+        };
+        ConstantBuffer<Params> gParams;
+        RWStructuredBuffer<float> gOutput;
+        Texture2D gTextures[4];
+
+        [shader("compute")]
+        [numthreads(8, 4, 1)]
+        void computeMain(uint3 tid : SV_DispatchThreadID)
+        {
+            gOutput[tid.x] = gParams.color.x * gParams.count + gTextures[1].Load(int3(0)).x;
+        }
+        )";
+
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK(slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+
+    ComPtr<slang::ICompileRequest> request;
+    SLANG_ALLOW_DEPRECATED_BEGIN
+    SLANG_CHECK_ABORT(
+        SLANG_SUCCEEDED(globalSession->createCompileRequest(request.writeRef())));
+    SLANG_ALLOW_DEPRECATED_END
+
+    // The binary form is written by `-reflection-binary`.
+    const String reflectionPath = Path::simplify(
+        Path::getParentDirectory(Path::getExecutablePath()) + "/binary-reflection-test" +
+        String(Process::getId()) + ".bin");
+    const char* args[] = {
+        "-target",
+        "hlsl",
+        "-profile",
+        "sm_5_0",
+        "-reflection-binary",
+        reflectionPath.getBuffer()};
+    SLANG_CHECK_ABORT(
+        SLANG_SUCCEEDED(request->processCommandLineArguments(args, SLANG_COUNT_OF(args))));
+    int translationUnitIndex = request->addTranslationUnit(SLANG_SOURCE_LANGUAGE_SLANG, "m");
+    request->addTranslationUnitSourceString(translationUnitIndex, "m.slang", userSourceBody);
+    request->addEntryPoint(translationUnitIndex, "computeMain", SLANG_STAGE_COMPUTE);
+    SLANG_CHECK_ABORT(SLANG_SUCCEEDED(request->compile()));
+
+    auto layout = (slang::ProgramLayout*)request->getReflection();
+    SLANG_CHECK_ABORT(layout != nullptr);
+
+    List<uint8_t> blob;
+    SLANG_CHECK_ABORT(SLANG_SUCCEEDED(File::readAllBytes(reflectionPath, blob)));
+    File::remove(reflectionPath);
+
+    auto reflection = getBinaryReflection(blob.getBuffer(), size_t(blob.getCount()));
+    SLANG_CHECK_ABORT(reflection != nullptr);
+
+    // Global parameters.
+    SLANG_CHECK(reflection->parameters.getElementCount() == Count(layout->getParameterCount()));
+
+    auto output = _findVariable(reflection, reflection->parameters, "gOutput");
+    SLANG_CHECK_ABORT(output != nullptr);
+    SLANG_CHECK_ABORT(output->bindings.getElementCount() == 1);
+    SLANG_CHECK(output->bindings[0].category.get() == SLANG_PARAMETER_CATEGORY_UNORDERED_ACCESS);
+
+    auto textures = _findVariable(reflection, reflection->parameters, "gTextures");
+    SLANG_CHECK_ABORT(textures != nullptr);
+    auto& texturesType = reflection->typeLayouts[textures->typeLayout.get()];
+    SLANG_CHECK(texturesType.kind.get() == UInt32(slang::TypeReflection::Kind::Array));
+    SLANG_CHECK(texturesType.elementCount.get() == 4);
+    SLANG_CHECK(texturesType.elementTypeLayout.get() >= 0);
+
+    // The constant buffer element type is a struct with two fields.
+    auto params = _findVariable(reflection, reflection->parameters, "gParams");
+    SLANG_CHECK_ABORT(params != nullptr);
+    auto& paramsType = reflection->typeLayouts[params->typeLayout.get()];
+    SLANG_CHECK_ABORT(paramsType.elementTypeLayout.get() >= 0);
+    auto& paramsElementType = reflection->typeLayouts[paramsType.elementTypeLayout.get()];
+    SLANG_CHECK(paramsElementType.name.get() == UnownedStringSlice("Params"));
+    SLANG_CHECK_ABORT(paramsElementType.fields.getElementCount() == 2);
+    auto& countField = reflection->variables[paramsElementType.fields[1].get()];
+    SLANG_CHECK(countField.name.get() == UnownedStringSlice("count"));
+    SLANG_CHECK_ABORT(countField.bindings.getElementCount() == 1);
+    SLANG_CHECK(countField.bindings[0].category.get() == SLANG_PARAMETER_CATEGORY_UNIFORM);
+    SLANG_CHECK(countField.bindings[0].offset.get() == 16);
+
+    // Entry point.
+    SLANG_CHECK_ABORT(reflection->entryPoints.getElementCount() == 1);
+    auto& entryPointInfo = reflection->entryPoints[0];
+    SLANG_CHECK(entryPointInfo.name.get() == UnownedStringSlice("computeMain"));
+    SLANG_CHECK(entryPointInfo.stage.get() == SLANG_STAGE_COMPUTE);
+    SLANG_CHECK(entryPointInfo.threadGroupSizeX.get() == 8);
+    SLANG_CHECK(entryPointInfo.threadGroupSizeY.get() == 4);
+    SLANG_CHECK(entryPointInfo.threadGroupSizeZ.get() == 1);
+    SLANG_CHECK(entryPointInfo.parameters.getElementCount() == 1);
+
+    // Data that isn't in the fossil format is rejected, even if it is large enough.
+    {
+        List<uint8_t> corrupted = blob;
+        corrupted[0] ^= 0xff;
+        SLANG_CHECK(
+            getBinaryReflection(corrupted.getBuffer(), size_t(corrupted.getCount())) == nullptr);
+    }
+
+    // So is data whose root is outside of it.
+    {
+        List<uint8_t> corrupted = blob;
+        const Int32 rootOffset = Int32(corrupted.getCount());
+        memcpy(
+            corrupted.getBuffer() + offsetof(Fossil::Header, rootValue),
+            &rootOffset,
+            sizeof(rootOffset));
+        SLANG_CHECK(
+            getBinaryReflection(corrupted.getBuffer(), size_t(corrupted.getCount())) == nullptr);
+    }
+}
@@ -0,0 +1,251 @@
+// unit-test-call-overload-cache.cpp
+
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+#include <stdlib.h>
+
+using namespace Slang;
+
+// Test the cache of overload resolutions for plain calls to core module functions (such as
+// `max(a, b)`): repeated calls are served from the cache, a user overload in another session is
+// not, and arguments that must be l-values are still checked.
+
+static String _getBlobString(ISlangBlob* blob)
+{
+    if (!blob)
+        return String();
+    return String(UnownedStringSlice(
+        (const char*)blob->getBufferPointer(),
+        (const char*)blob->getBufferPointer() + blob->getBufferSize()));
+}
+
+/// Compile `source` in a new global session with `-report-perf-benchmark`, and return the
+/// number of call overload cache hits it reports.
+static Int _getReportedCallCacheHitCount(const char* source)
+{
+    ComPtr<slang::IGlobalSession> globalSession;
+    if (SLANG_FAILED(slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef())))
+        return -1;
+
+    ComPtr<slang::ICompileRequest> request;
+    SLANG_ALLOW_DEPRECATED_BEGIN
+    SlangResult result = globalSession->createCompileRequest(request.writeRef());
+    SLANG_ALLOW_DEPRECATED_END
+    if (SLANG_FAILED(result))
+        return -1;
+
+    const char* args[] = {"-report-perf-benchmark"};
+    request->processCommandLineArguments(args, SLANG_COUNT_OF(args));
+    request->addCodeGenTarget(SLANG_HLSL);
+    int translationUnitIndex =
+        request->addTranslationUnit(SLANG_SOURCE_LANGUAGE_SLANG, "callCache");
+    request->addTranslationUnitSourceString(translationUnitIndex, "callCache.slang", source);
+    request->addEntryPoint(translationUnitIndex, "computeMain", SLANG_STAGE_COMPUTE);
+    if (SLANG_FAILED(request->compile()))
+        return -1;
+
+    UnownedStringSlice output = UnownedStringSlice(request->getDiagnosticOutput());
+    const auto prefix = toSlice("Call Overload Cache: ");
+    const Index index = output.indexOf(prefix);
+    if (index < 0)
+        return -1;
+    return Int(atoll(output.begin() + index + prefix.getLength()));
+}
+
+static String _compileInSession(
+    slang::ISession* session,
+    const char* name,
+    const char* source,
+    String* outDiagnostics = nullptr)
+{
+    String moduleName = name;
+    ComPtr<slang::IBlob> diagnosticBlob;
+    auto module = session->loadModuleFromSourceString(
+        moduleName.getBuffer(),
+        (moduleName + ".slang").getBuffer(),
+        source,
+        diagnosticBlob.writeRef());
+    if (outDiagnostics)
+        *outDiagnostics = _getBlobString(diagnosticBlob);
+    if (!module)
+        return String();
+
+    ComPtr<slang::IEntryPoint> entryPoint;
+    module->findEntryPointByName("computeMain", entryPoint.writeRef());
+    if (!entryPoint)
+        return String();
+
+    slang::IComponentType* components[] = {module, entryPoint.get()};
+    ComPtr<slang::IComponentType> program;
+    session->createCompositeComponentType(components, 2, program.writeRef());
+    if (!program)
+        return String();
+
+    ComPtr<slang::IComponentType> linkedProgram;
+    program->link(linkedProgram.writeRef(), diagnosticBlob.writeRef());
+    if (!linkedProgram)
+        return String();
+
+    ComPtr<slang::IBlob> code;
+    linkedProgram->getEntryPointCode(0, 0, code.writeRef(), diagnosticBlob.writeRef());
+    return _getBlobString(code);
+}
+
+static ComPtr<slang::ISession> _createSession(slang::IGlobalSession* globalSession)
+{
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = SLANG_HLSL;
+    targetDesc.profile = globalSession->findProfile("sm_5_0");
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targetCount = 1;
+    sessionDesc.targets = &targetDesc;
+
+    ComPtr<slang::ISession> session;
+    globalSession->createSession(sessionDesc, session.writeRef());
+    return session;
+}
+
+SLANG_UNIT_TEST(callOverloadCache)
+{
+    // Repeated calls to `max(float3, float3)` are resolved once, and then served from the cache.
+    {
+        const char* oneCallSource = R"(
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<float3> output)
+            {
+                float3 a = float3(tid);
+                float3 b = output[0];
+                output[tid.x] = max(a, b);
+            }
+            )";
+        const char* threeCallSource = R"(
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<float3> output)
+            {
+                float3 a = float3(tid);
+                float3 b = output[0];
+                output[tid.x] = max(a, b) + max(a, b) + max(a, b);
+            }
+            )";
+
+        // Each compile uses its own global session, so they all start with an empty cache.
+        const Int oneCallCount = _getReportedCallCacheHitCount(oneCallSource);
+        const Int repeatedOneCallCount = _getReportedCallCacheHitCount(oneCallSource);
+        const Int threeCallCount = _getReportedCallCacheHitCount(threeCallSource);
+        SLANG_CHECK_ABORT(oneCallCount >= 0 && repeatedOneCallCount >= 0 && threeCallCount >= 0);
+
+        // The reported counts only cover the compile they are reported for.
+        SLANG_CHECK(repeatedOneCallCount == oneCallCount);
+
+        // The two extra calls are both hits.
+        SLANG_CHECK(threeCallCount - oneCallCount == 2);
+    }
+
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+
+    // A user overload of `max` is used in a session that has one, even after another session
+    // sharing the global session has cached the core module `max` for the same arguments.
+    {
+        const char* coreMaxSource = R"(
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<float3> output)
+            {
+                output[tid.x] = max(float3(tid), output[0]);
+            }
+            )";
+        const char* userMaxSource = R"(
+            float3 max(float3 a, float3 b) { return a * 7.0 + b; }
+
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<float3> output)
+            {
+                output[tid.x] = max(float3(tid), output[0]);
+            }
+            )";
+
+        {
+            // Closing the session hands its cache over to the global session.
+            auto session = _createSession(globalSession);
+            SLANG_CHECK_ABORT(session != nullptr);
+            String code = _compileInSession(session, "coreMax", coreMaxSource);
+            SLANG_CHECK(code.indexOf(toSlice("max(")) != -1);
+        }
+        {
+            auto session = _createSession(globalSession);
+            SLANG_CHECK_ABORT(session != nullptr);
+            String code = _compileInSession(session, "userMax", userMaxSource);
+            SLANG_CHECK(code.indexOf(toSlice("7.0")) != -1);
+        }
+    }
+
+    // Once a call with an `out` argument has been cached, later calls still check that the
+    // arguments are l-values.
+    {
+        const char* validSource = R"(
+            groupshared int counter;
+
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<int> output)
+            {
+                int value = int(tid.x);
+                int original;
+                InterlockedAdd(counter, value, original);
+                output[0] = original;
+                InterlockedAdd(counter, value, original);
+                output[1] = original;
+            }
+            )";
+        const char* rvalueOutSource = R"(
+            groupshared int counter;
+
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<int> output)
+            {
+                int value = int(tid.x);
+                int original;
+                InterlockedAdd(counter, value, original);
+                output[0] = original;
+                InterlockedAdd(counter, value, value + 1);
+            }
+            )";
+        const char* rvalueDestSource = R"(
+            groupshared int counter;
+
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<int> output)
+            {
+                int value = int(tid.x);
+                int original;
+                InterlockedAdd(counter, value, original);
+                output[0] = original;
+                InterlockedAdd(counter + 0, value, original);
+            }
+            )";
+
+        auto session = _createSession(globalSession);
+        SLANG_CHECK_ABORT(session != nullptr);
+
+        String code = _compileInSession(session, "interlockedValid", validSource);
+        SLANG_CHECK(code.getLength() != 0);
+
+        String diagnostics;
+        code = _compileInSession(session, "interlockedRValueOut", rvalueOutSource, &diagnostics);
+        SLANG_CHECK(code.getLength() == 0);
+        SLANG_CHECK(diagnostics.indexOf(toSlice("error")) != -1);
+
+        code = _compileInSession(session, "interlockedRValueDest", rvalueDestSource, &diagnostics);
+        SLANG_CHECK(code.getLength() == 0);
+        SLANG_CHECK(diagnostics.indexOf(toSlice("error")) != -1);
+    }
+}
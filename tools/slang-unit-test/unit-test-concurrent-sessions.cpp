@@ -0,0 +1,109 @@
+// unit-test-concurrent-sessions.cpp
+
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+#include <thread>
+
+using namespace Slang;
+
+// Test that sessions created from the same global session can compile on different threads at the
+// same time. They share the global session's root AST builder, which interns the `Val`s that only
+// refer to the core module, and they resolve those `Val`s on their own threads.
+
+static bool _compileOnSession(slang::IGlobalSession* globalSession, int index)
+{
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = SLANG_HLSL;
+    targetDesc.profile = globalSession->findProfile("sm_5_0");
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targetCount = 1;
+    sessionDesc.targets = &targetDesc;
+
+    ComPtr<slang::ISession> session;
+    if (SLANG_FAILED(globalSession->createSession(sessionDesc, session.writeRef())))
+        return false;
+
+    // Each thread uses a different mix of core module types and generics, so that new `Val`s
+    // are interned on the root builder from every thread.
+    StringBuilder source;
+    source << "static const int kIndex = " << index << ";\n";
+    source << "typedef vector<float, " << (2 + index % 3) << "> Vec;\n";
+    source << R"(
+        float4 summarize<let N : int>(vector<float, N> v)
+        {
+            return float4(v[0], float(N), float(kIndex), 0);
+        }
+
+        [shader("compute")]
+        [numthreads(4, 1, 1)]
+        void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<float4> output)
+        {
+            Vec v = Vec(float(tid.x));
+            float4 result = summarize(v) + float4(half4(tid.xyzx));
+            output[tid.x] = max(result, float4(1));
+        }
+        )";
+
+    String moduleName = String("concurrent") + String(index);
+    ComPtr<slang::IBlob> diagnosticBlob;
+    auto module = session->loadModuleFromSourceString(
+        moduleName.getBuffer(),
+        (moduleName + ".slang").getBuffer(),
+        source.getBuffer(),
+        diagnosticBlob.writeRef());
+    if (!module)
+        return false;
+
+    ComPtr<slang::IEntryPoint> entryPoint;
+    module->findEntryPointByName("computeMain", entryPoint.writeRef());
+    if (!entryPoint)
+        return false;
+
+    slang::IComponentType* components[] = {module, entryPoint.get()};
+    ComPtr<slang::IComponentType> program;
+    session->createCompositeComponentType(components, 2, program.writeRef());
+    if (!program)
+        return false;
+
+    ComPtr<slang::IComponentType> linkedProgram;
+    program->link(linkedProgram.writeRef(), diagnosticBlob.writeRef());
+    if (!linkedProgram)
+        return false;
+
+    ComPtr<slang::IBlob> code;
+    linkedProgram->getEntryPointCode(0, 0, code.writeRef(), diagnosticBlob.writeRef());
+    return code != nullptr;
+}
+
+SLANG_UNIT_TEST(concurrentSessions)
+{
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+
+    const int kThreadCount = 8;
+    const int kRoundCount = 4;
+
+    // Sessions are created on the threads as well, so that creating them is concurrent too.
+    bool succeeded[kThreadCount * kRoundCount] = {};
+    List<std::thread> threads;
+    for (int i = 0; i < kThreadCount; ++i)
+    {
+        threads.add(std::thread(
+            [&, i]()
+            {
+                for (int round = 0; round < kRoundCount; ++round)
+                {
+                    const int index = i * kRoundCount + round;
+                    succeeded[index] = _compileOnSession(globalSession, index);
+                }
+            }));
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int i = 0; i < kThreadCount * kRoundCount; ++i)
+        SLANG_CHECK(succeeded[i]);
+}
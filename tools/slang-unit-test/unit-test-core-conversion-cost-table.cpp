@@ -0,0 +1,140 @@
+// unit-test-core-conversion-cost-table.cpp
+
+#include "../../source/core/slang-archive-file-system.h"
+#include "../../source/core/slang-castable.h"
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+#include <stdlib.h>
+
+using namespace Slang;
+
+// Test that saving the core module stores a table of conversion costs next to it, that loading
+// the saved core module reads the table, and that a table written with a different key layout is
+// ignored.
+
+static const char kCoreModuleFileName[] = "core.slang-module";
+static const char kConversionCostTableFileName[] = "core.slang-conversion-costs";
+
+// The table starts with a version, the size of a key, and the number of entries.
+static const size_t kTableKeySizeOffset = sizeof(uint32_t);
+static const size_t kTableEntryCountOffset = sizeof(uint32_t) * 2;
+
+/// Create a global session from the serialized core module in `coreModule`, compile a small
+/// program with it, and return the number of table entries it reports having read.
+static Int _getLoadedTableEntryCount(ISlangBlob* coreModule)
+{
+    ComPtr<slang::IGlobalSession> globalSession;
+    SlangResult result =
+        slang_createGlobalSessionWithoutCoreModule(SLANG_API_VERSION, globalSession.writeRef());
+    if (SLANG_FAILED(result))
+        return -1;
+    if (SLANG_FAILED(globalSession->loadCoreModule(
+            coreModule->getBufferPointer(),
+            coreModule->getBufferSize())))
+        return -1;
+
+    ComPtr<slang::ICompileRequest> request;
+    SLANG_ALLOW_DEPRECATED_BEGIN
+    result = globalSession->createCompileRequest(request.writeRef());
+    SLANG_ALLOW_DEPRECATED_END
+    if (SLANG_FAILED(result))
+        return -1;
+
+    const char* source = R"(
+        [shader("compute")]
+        [numthreads(1, 1, 1)]
+        void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<float3> output)
+        {
+            half3 h = half3(tid);
+            output[tid.x] = h + int3(tid);
+        }
+        )";
+    const char* args[] = {"-report-perf-benchmark"};
+    request->processCommandLineArguments(args, SLANG_COUNT_OF(args));
+    request->addCodeGenTarget(SLANG_HLSL);
+    int translationUnitIndex =
+        request->addTranslationUnit(SLANG_SOURCE_LANGUAGE_SLANG, "conversionCosts");
+    request->addTranslationUnitSourceString(translationUnitIndex, "conversionCosts.slang", source);
+    request->addEntryPoint(translationUnitIndex, "computeMain", SLANG_STAGE_COMPUTE);
+    if (SLANG_FAILED(request->compile()))
+        return -1;
+
+    UnownedStringSlice output = UnownedStringSlice(request->getDiagnosticOutput());
+    const auto prefix = toSlice("Core Conversion Cost Table: ");
+    const Index index = output.indexOf(prefix);
+    if (index < 0)
+        return -1;
+    return Int(atoll(output.begin() + index + prefix.getLength()));
+}
+
+SLANG_UNIT_TEST(coreConversionCostTable)
+{
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+
+    ComPtr<ISlangBlob> coreModule;
+    SLANG_CHECK_ABORT(
+        globalSession->saveCoreModule(SLANG_ARCHIVE_TYPE_RIFF, coreModule.writeRef()) == SLANG_OK);
+
+    // The saved archive holds the table next to the module.
+    ComPtr<ISlangFileSystemExt> archive;
+    SLANG_CHECK_ABORT(
+        loadArchiveFileSystem(
+            coreModule->getBufferPointer(),
+            coreModule->getBufferSize(),
+            archive) == SLANG_OK);
+
+    ComPtr<ISlangBlob> moduleBlob;
+    SLANG_CHECK_ABORT(archive->loadFile(kCoreModuleFileName, moduleBlob.writeRef()) == SLANG_OK);
+    ComPtr<ISlangBlob> tableBlob;
+    SLANG_CHECK_ABORT(
+        archive->loadFile(kConversionCostTableFileName, tableBlob.writeRef()) == SLANG_OK);
+    SLANG_CHECK_ABORT(tableBlob->getBufferSize() >= kTableEntryCountOffset + sizeof(uint32_t));
+
+    uint32_t entryCount = 0;
+    memcpy(
+        &entryCount,
+        (const uint8_t*)tableBlob->getBufferPointer() + kTableEntryCountOffset,
+        sizeof(entryCount));
+    SLANG_CHECK(entryCount > 0);
+
+    // Loading the saved core module reads every entry of the table.
+    SLANG_CHECK(_getLoadedTableEntryCount(coreModule) == Int(entryCount));
+
+    // A table written with a different key size is ignored, and the core module still loads.
+    {
+        List<uint8_t> table;
+        table.addRange(
+            (const uint8_t*)tableBlob->getBufferPointer(),
+            Index(tableBlob->getBufferSize()));
+        uint32_t keySize = 0;
+        memcpy(&keySize, table.getBuffer() + kTableKeySizeOffset, sizeof(keySize));
+        keySize++;
+        memcpy(table.getBuffer() + kTableKeySizeOffset, &keySize, sizeof(keySize));
+
+        ComPtr<ISlangMutableFileSystem> patchedArchive;
+        SLANG_CHECK_ABORT(
+            createArchiveFileSystem(SLANG_ARCHIVE_TYPE_RIFF, patchedArchive) == SLANG_OK);
+        SLANG_CHECK_ABORT(
+            patchedArchive->saveFile(
+                kCoreModuleFileName,
+                moduleBlob->getBufferPointer(),
+                moduleBlob->getBufferSize()) == SLANG_OK);
+        SLANG_CHECK_ABORT(
+            patchedArchive->saveFile(
+                kConversionCostTableFileName,
+                table.getBuffer(),
+                table.getCount()) == SLANG_OK);
+
+        ComPtr<ISlangBlob> patchedCoreModule;
+        auto archiveFileSystem = as<IArchiveFileSystem>(patchedArchive.get());
+        SLANG_CHECK_ABORT(archiveFileSystem != nullptr);
+        SLANG_CHECK_ABORT(
+            archiveFileSystem->storeArchive(true, patchedCoreModule.writeRef()) == SLANG_OK);
+
+        SLANG_CHECK(_getLoadedTableEntryCount(patchedCoreModule) == 0);
+    }
+}
@@ -0,0 +1,176 @@
+// unit-test-decl-cost-report.cpp
+
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+using namespace Slang;
+
+// Test that `ISession::getDeclarationCostReport` returns the costs of what was compiled since the
+// previous call, including modules loaded before it, and is only available when the session
+// reports declaration costs.
+
+static ComPtr<slang::ISession> _createSession(
+    slang::IGlobalSession* globalSession,
+    bool reportDeclarationCosts)
+{
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = SLANG_HLSL;
+    targetDesc.profile = globalSession->findProfile("sm_5_0");
+
+    slang::CompilerOptionEntry entry;
+    entry.name = slang::CompilerOptionName::ReportDeclarationCosts;
+    entry.value.kind = slang::CompilerOptionValueKind::Int;
+    entry.value.intValue0 = 1;
+
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targetCount = 1;
+    sessionDesc.targets = &targetDesc;
+    if (reportDeclarationCosts)
+    {
+        sessionDesc.compilerOptionEntries = &entry;
+        sessionDesc.compilerOptionEntryCount = 1;
+    }
+
+    ComPtr<slang::ISession> session;
+    globalSession->createSession(sessionDesc, session.writeRef());
+    return session;
+}
+
+static ComPtr<slang::IModule> _loadModule(
+    slang::ISession* session,
+    const char* name,
+    const char* source)
+{
+    String moduleName = name;
+    ComPtr<slang::IBlob> diagnosticBlob;
+    ComPtr<slang::IModule> module(session->loadModuleFromSourceString(
+        moduleName.getBuffer(),
+        (moduleName + ".slang").getBuffer(),
+        source,
+        diagnosticBlob.writeRef()));
+    return module;
+}
+
+/// Link `module` with its `computeMain` entry point, and generate code for it.
+static bool _compile(slang::ISession* session, slang::IModule* module)
+{
+    ComPtr<slang::IBlob> diagnosticBlob;
+    ComPtr<slang::IEntryPoint> entryPoint;
+    module->findEntryPointByName("computeMain", entryPoint.writeRef());
+    if (!entryPoint)
+        return false;
+
+    slang::IComponentType* components[] = {module, entryPoint.get()};
+    ComPtr<slang::IComponentType> program;
+    session->createCompositeComponentType(components, 2, program.writeRef());
+    if (!program)
+        return false;
+
+    ComPtr<slang::IComponentType> linkedProgram;
+    program->link(linkedProgram.writeRef(), diagnosticBlob.writeRef());
+    if (!linkedProgram)
+        return false;
+
+    ComPtr<slang::IBlob> code;
+    linkedProgram->getEntryPointCode(0, 0, code.writeRef(), diagnosticBlob.writeRef());
+    return code != nullptr;
+}
+
+static bool _compile(slang::ISession* session, const char* name, const char* source)
+{
+    auto module = _loadModule(session, name, source);
+    return module && _compile(session, module);
+}
+
+static String _getReport(slang::ISession* session)
+{
+    ComPtr<ISlangBlob> reportBlob;
+    if (SLANG_FAILED(session->getDeclarationCostReport(20, reportBlob.writeRef())))
+        return String();
+    return String(UnownedStringSlice(
+        (const char*)reportBlob->getBufferPointer(),
+        (const char*)reportBlob->getBufferPointer() + reportBlob->getBufferSize()));
+}
+
+/// Get the section of `report` that lists instruction counts by source declaration.
+static String _getDeclInstSection(const String& report)
+{
+    const auto text = report.getUnownedSlice();
+    const Index begin = text.indexOf(toSlice("by source declaration:"));
+    const Index end = text.indexOf(toSlice("by function:"));
+    if (begin < 0 || end < begin)
+        return String();
+    return String(text.subString(begin, end - begin));
+}
+
+SLANG_UNIT_TEST(declCostReport)
+{
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+
+    const char* firstSource = R"(
+        float firstHelper(float x)
+        {
+            return x * 2.0 + 1.0;
+        }
+
+        [shader("compute")]
+        [numthreads(1, 1, 1)]
+        void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<float> output)
+        {
+            output[tid.x] = firstHelper(float(tid.x));
+        }
+        )";
+    const char* secondSource = R"(
+        float secondHelper(float x)
+        {
+            return x * 3.0 - 1.0;
+        }
+
+        [shader("compute")]
+        [numthreads(1, 1, 1)]
+        void computeMain(uint3 tid : SV_DispatchThreadID, RWStructuredBuffer<float> output)
+        {
+            output[tid.x] = secondHelper(float(tid.x));
+        }
+        )";
+
+    // Without the option there is no report.
+    {
+        auto session = _createSession(globalSession, false);
+        SLANG_CHECK_ABORT(session != nullptr);
+        SLANG_CHECK(_compile(session, "declCostNoReport", firstSource));
+
+        ComPtr<ISlangBlob> reportBlob;
+        SLANG_CHECK(
+            session->getDeclarationCostReport(20, reportBlob.writeRef()) == SLANG_E_NOT_AVAILABLE);
+    }
+
+    auto session = _createSession(globalSession, true);
+    SLANG_CHECK_ABORT(session != nullptr);
+
+    // Each report covers the compiles since the previous one.
+    auto firstModule = _loadModule(session, "declCostFirst", firstSource);
+    SLANG_CHECK_ABORT(firstModule != nullptr);
+    SLANG_CHECK(_compile(session, firstModule));
+    String report = _getReport(session);
+    SLANG_CHECK(report.indexOf(toSlice("firstHelper")) != -1);
+
+    SLANG_CHECK(_compile(session, "declCostSecond", secondSource));
+    report = _getReport(session);
+    SLANG_CHECK(report.indexOf(toSlice("secondHelper")) != -1);
+    SLANG_CHECK(report.indexOf(toSlice("firstHelper")) == -1);
+
+    // Nothing has been compiled since, so the report is empty.
+    report = _getReport(session);
+    SLANG_CHECK(report.indexOf(toSlice("Helper")) == -1);
+
+    // A module that was loaded before a report was taken is not lowered again, but the code
+    // generated from it is still traced back to its declarations.
+    SLANG_CHECK(_compile(session, firstModule));
+    report = _getReport(session);
+    SLANG_CHECK(_getDeclInstSection(report).indexOf(toSlice("firstHelper")) != -1);
+    SLANG_CHECK(report.indexOf(toSlice("secondHelper")) == -1);
+}
@@ -0,0 +1,152 @@
+// unit-test-downstream-compile-cache.cpp
+
+#include "../../source/compiler-core/slang-artifact-associated-impl.h"
+#include "../../source/compiler-core/slang-artifact-util.h"
+#include "../../source/compiler-core/slang-downstream-compile-cache.h"
+#include "../../source/core/slang-blob.h"
+#include "../../source/core/slang-io.h"
+#include "../../source/core/slang-process.h"
+#include "../../source/core/slang-string-util.h"
+#include "unit-test/slang-unit-test.h"
+
+using namespace Slang;
+
+namespace
+{ // anonymous
+
+// A downstream compiler that "compiles" by reversing its source, and reports a warning.
+class ReversingDownstreamCompiler : public DownstreamCompilerBase
+{
+public:
+    virtual SLANG_NO_THROW SlangResult SLANG_MCALL
+    compile(const CompileOptions& options, IArtifact** outArtifact) SLANG_OVERRIDE
+    {
+        ++m_compileCount;
+
+        ComPtr<ISlangBlob> sourceBlob;
+        SLANG_RETURN_ON_FAIL(
+            options.sourceArtifacts[0]->loadBlob(ArtifactKeep::No, sourceBlob.writeRef()));
+
+        const auto source = StringUtil::getSlice(sourceBlob);
+        StringBuilder product;
+        for (Index i = source.getLength() - 1; i >= 0; --i)
+            product.appendChar(source[i]);
+
+        auto diagnostics = ArtifactDiagnostics::create();
+        ArtifactDiagnostic diagnostic;
+        diagnostic.severity = ArtifactDiagnostic::Severity::Warning;
+        diagnostic.text = TerminatedCharSlice("reversed");
+        diagnostic.location.line = 3;
+        diagnostics->add(diagnostic);
+
+        auto artifact = ArtifactUtil::createArtifactForCompileTarget(options.targetType);
+        artifact->addRepresentationUnknown(StringBlob::moveCreate(product));
+        ArtifactUtil::addAssociated(artifact, diagnostics);
+
+        if (m_addDebugInfo)
+        {
+            auto debugInfo = ArtifactUtil::createArtifact(
+                ArtifactDesc::make(ArtifactKind::BinaryFormat, ArtifactPayload::PdbDebugInfo));
+            debugInfo->addRepresentationUnknown(StringBlob::create(toSlice("debug")));
+            artifact->addAssociated(debugInfo);
+        }
+
+        *outArtifact = artifact.detach();
+        return SLANG_OK;
+    }
+    virtual SLANG_NO_THROW bool SLANG_MCALL isFileBased() SLANG_OVERRIDE { return false; }
+
+    ReversingDownstreamCompiler()
+        : DownstreamCompilerBase(DownstreamCompilerDesc(SLANG_PASS_THROUGH_DXC, 1, 0))
+    {
+    }
+
+    Count m_compileCount = 0;
+
+    /// If set, the product has separate debug info associated with it.
+    bool m_addDebugInfo = false;
+};
+
+} // namespace
+
+static String _compile(
+    DownstreamCompileCache* cache,
+    IDownstreamCompiler* compiler,
+    const char* source,
+    const char* entryPointName)
+{
+    auto sourceArtifact = ArtifactUtil::createArtifact(
+        ArtifactDesc::make(ArtifactKind::Source, ArtifactPayload::HLSL));
+    sourceArtifact->addRepresentationUnknown(StringBlob::create(UnownedStringSlice(source)));
+    IArtifact* sourceArtifacts[] = {sourceArtifact};
+
+    DownstreamCompileOptions options;
+    options.targetType = SLANG_DXIL;
+    options.sourceLanguage = SLANG_SOURCE_LANGUAGE_HLSL;
+    options.sourceArtifacts = makeSlice(sourceArtifacts, 1);
+    options.entryPointName = TerminatedCharSlice(entryPointName);
+
+    ComPtr<IArtifact> artifact;
+    if (SLANG_FAILED(cache->compile(compiler, options, artifact.writeRef())))
+        return String();
+
+    // The diagnostics come back with the product, whether it was cached or not.
+    auto diagnostics = findAssociatedRepresentation<IArtifactDiagnostics>(artifact);
+    if (!diagnostics || diagnostics->getCount() != 1 ||
+        asStringSlice(diagnostics->getAt(0)->text) != toSlice("reversed") ||
+        diagnostics->getAt(0)->location.line != 3)
+    {
+        return String();
+    }
+
+    ComPtr<ISlangBlob> blob;
+    if (SLANG_FAILED(artifact->loadBlob(ArtifactKeep::No, blob.writeRef())))
+        return String();
+    return StringUtil::getString(blob);
+}
+
+SLANG_UNIT_TEST(downstreamCompileCache)
+{
+    const String cacheDirectory = Path::simplify(
+        Path::getParentDirectory(Path::getExecutablePath()) + "/downstream-compile-cache-test" +
+        String(Process::getId()));
+
+    ComPtr<ReversingDownstreamCompiler> compiler(new ReversingDownstreamCompiler);
+
+    {
+        RefPtr<DownstreamCompileCache> cache = new DownstreamCompileCache(cacheDirectory);
+
+        // The first compile runs the compiler, the second one is served by the cache.
+        SLANG_CHECK(_compile(cache, compiler, "abc", "main") == "cba");
+        SLANG_CHECK(_compile(cache, compiler, "abc", "main") == "cba");
+        SLANG_CHECK(compiler->m_compileCount == 1);
+
+        // Changing the source or the options is a different compilation.
+        SLANG_CHECK(_compile(cache, compiler, "abd", "main") == "dba");
+        SLANG_CHECK(_compile(cache, compiler, "abc", "other") == "cba");
+        SLANG_CHECK(compiler->m_compileCount == 3);
+
+        auto stats = cache->getStats();
+        SLANG_CHECK(stats.hitCount == 1);
+        SLANG_CHECK(stats.missCount == 3);
+    }
+
+    // The entries persist for later caches using the same directory.
+    {
+        RefPtr<DownstreamCompileCache> cache = new DownstreamCompileCache(cacheDirectory);
+        SLANG_CHECK(_compile(cache, compiler, "abd", "main") == "dba");
+        SLANG_CHECK(compiler->m_compileCount == 3);
+    }
+
+    // Products with debug info associated with them aren't cached, as the debug info isn't stored.
+    {
+        RefPtr<DownstreamCompileCache> cache = new DownstreamCompileCache(cacheDirectory);
+        compiler->m_addDebugInfo = true;
+        SLANG_CHECK(_compile(cache, compiler, "xyz", "main") == "zyx");
+        SLANG_CHECK(_compile(cache, compiler, "xyz", "main") == "zyx");
+        SLANG_CHECK(compiler->m_compileCount == 5);
+        SLANG_CHECK(cache->getStats().hitCount == 0);
+    }
+
+    Path::removeNonEmpty(cacheDirectory);
+}
@@ -0,0 +1,129 @@
+// unit-test-downstream-compile-queue.cpp
+
+#include "../../source/compiler-core/slang-artifact-util.h"
+#include "../../source/compiler-core/slang-downstream-compile-queue.h"
+#include "../../source/compiler-core/slang-slice-allocator.h"
+#include "../../source/core/slang-blob.h"
+#include "../../source/core/slang-string-util.h"
+#include "unit-test/slang-unit-test.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+using namespace Slang;
+
+namespace
+{ // anonymous
+
+// A downstream compiler that "compiles" by appending the entry point name to its source. The
+// first compilations are held until `kOverlapCount` of them are running at once, so that the test
+// doesn't rely on timing to see them overlap.
+class AppendingDownstreamCompiler : public DownstreamCompilerBase
+{
+public:
+    static const int kOverlapCount = 2;
+
+    virtual SLANG_NO_THROW SlangResult SLANG_MCALL
+    compile(const CompileOptions& options, IArtifact** outArtifact) SLANG_OVERRIDE
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_runningCount++;
+            m_maxRunningCount = std::max(m_maxRunningCount, m_runningCount);
+            if (m_runningCount >= kOverlapCount)
+            {
+                m_hasOverlapped = true;
+                m_condition.notify_all();
+            }
+
+            // The timeout only stops a queue that never overlaps compilations from hanging the
+            // test, which then fails on the maximum running count.
+            m_condition.wait_for(lock, std::chrono::seconds(10), [&] { return m_hasOverlapped; });
+        }
+
+        ComPtr<ISlangBlob> sourceBlob;
+        SlangResult res =
+            options.sourceArtifacts[0]->loadBlob(ArtifactKeep::No, sourceBlob.writeRef());
+        if (SLANG_SUCCEEDED(res))
+        {
+            StringBuilder product;
+            product << StringUtil::getSlice(sourceBlob) << asStringSlice(options.entryPointName);
+
+            auto artifact = ArtifactUtil::createArtifactForCompileTarget(options.targetType);
+            artifact->addRepresentationUnknown(StringBlob::moveCreate(product));
+            *outArtifact = artifact.detach();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_runningCount--;
+        }
+        return res;
+    }
+    // Claim to be a separate process, so that the queue is happy to run more than one at once.
+    virtual SLANG_NO_THROW bool SLANG_MCALL isFileBased() SLANG_OVERRIDE { return true; }
+
+    AppendingDownstreamCompiler()
+        : DownstreamCompilerBase(DownstreamCompilerDesc(SLANG_PASS_THROUGH_CLANG, 1, 0))
+    {
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    int m_runningCount = 0;
+    int m_maxRunningCount = 0;
+    bool m_hasOverlapped = false;
+};
+
+} // namespace
+
+SLANG_UNIT_TEST(downstreamCompileQueue)
+{
+    ComPtr<AppendingDownstreamCompiler> compiler(new AppendingDownstreamCompiler);
+    SLANG_CHECK(DownstreamCompileQueue::canCompileOnThread(compiler));
+
+    RefPtr<DownstreamCompileQueue> queue =
+        new DownstreamCompileQueue(AppendingDownstreamCompiler::kOverlapCount);
+
+    const Count jobCount = 6;
+    List<RefPtr<DownstreamCompileQueue::Job>> jobs;
+    for (Index i = 0; i < jobCount; ++i)
+    {
+        // Everything the options refer to goes out of scope before the job has finished.
+        String source = "source" + String(i);
+        String entryPointName = "main" + String(i);
+
+        auto sourceArtifact = ArtifactUtil::createArtifact(
+            ArtifactDesc::make(ArtifactKind::Source, ArtifactPayload::C));
+        sourceArtifact->addRepresentationUnknown(StringBlob::create(source));
+        IArtifact* sourceArtifacts[] = {sourceArtifact};
+
+        DownstreamCompileOptions options;
+        options.targetType = SLANG_OBJECT_CODE;
+        options.sourceLanguage = SLANG_SOURCE_LANGUAGE_C;
+        options.sourceArtifacts = makeSlice(sourceArtifacts, 1);
+        options.entryPointName = SliceUtil::asTerminatedCharSlice(entryPointName);
+
+        jobs.add(queue->add(compiler, options, nullptr));
+    }
+    SLANG_CHECK(queue->getPendingCount() == jobCount);
+
+    queue->wait();
+    SLANG_CHECK(queue->getPendingCount() == 0);
+
+    // No more than the maximum ran at once, but they did overlap.
+    SLANG_CHECK(compiler->m_maxRunningCount == AppendingDownstreamCompiler::kOverlapCount);
+
+    for (Index i = 0; i < jobCount; ++i)
+    {
+        auto job = jobs[i];
+        SLANG_CHECK(SLANG_SUCCEEDED(job->getResult()));
+
+        ComPtr<ISlangBlob> blob;
+        SLANG_CHECK_ABORT(
+            job->getArtifact() &&
+            SLANG_SUCCEEDED(job->getArtifact()->loadBlob(ArtifactKeep::No, blob.writeRef())));
+        SLANG_CHECK(StringUtil::getString(blob) == "source" + String(i) + "main" + String(i));
+    }
+}
@@ -0,0 +1,108 @@
+// unit-test-invalidate-stale-modules.cpp
+
+#include "../../source/core/slang-io.h"
+#include "../../source/core/slang-process.h"
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+using namespace Slang;
+
+// Test that `ISession::invalidateStaleModules` only drops the modules affected by an edit,
+// and that reloading them picks up the new source.
+
+/// Generate code for the `computeMain` entry point of `module`.
+static String _getEntryPointCode(slang::ISession* session, slang::IModule* module)
+{
+    ComPtr<slang::IEntryPoint> entryPoint;
+    module->findEntryPointByName("computeMain", entryPoint.writeRef());
+    if (!entryPoint)
+        return String();
+
+    slang::IComponentType* components[] = {module, entryPoint.get()};
+    ComPtr<slang::IComponentType> program;
+    session->createCompositeComponentType(components, 2, program.writeRef());
+    if (!program)
+        return String();
+
+    ComPtr<slang::IComponentType> linkedProgram;
+    program->link(linkedProgram.writeRef());
+    if (!linkedProgram)
+        return String();
+
+    ComPtr<slang::IBlob> code;
+    linkedProgram->getEntryPointCode(0, 0, code.writeRef());
+    if (!code)
+        return String();
+    return String(UnownedStringSlice(
+        (const char*)code->getBufferPointer(),
+        code->getBufferSize()));
+}
+
+SLANG_UNIT_TEST(invalidateStaleModules)
+{
+    const String suffix = String(Process::getId());
+    const String baseName = "staleBase" + suffix;
+    const String userName = "staleUser" + suffix;
+    const String otherName = "staleOther" + suffix;
+
+    File::writeAllText(baseName + ".slang", "public int f() { return 1; }");
+    File::writeAllText(
+        userName + ".slang",
+        "import " + baseName +
+            ";\npublic int g() { return f(); }\n"
+            "[shader(\"compute\")] [numthreads(1, 1, 1)]\n"
+            "void computeMain(uniform RWStructuredBuffer<int> output) { output[0] = g(); }");
+    File::writeAllText(otherName + ".slang", "public int h() { return 2; }");
+
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = SLANG_HLSL;
+    targetDesc.profile = globalSession->findProfile("sm_5_0");
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targetCount = 1;
+    sessionDesc.targets = &targetDesc;
+    ComPtr<slang::ISession> session;
+    SLANG_CHECK_ABORT(globalSession->createSession(sessionDesc, session.writeRef()) == SLANG_OK);
+
+    // Hold on to the original module, so that it can't be freed and its address reused.
+    ComPtr<slang::IModule> userModule(session->loadModule(userName.getBuffer()));
+    auto otherModule = session->loadModule(otherName.getBuffer());
+    SLANG_CHECK_ABORT(userModule && otherModule);
+
+    const SlangInt loadedCount = session->getLoadedModuleCount();
+    const String originalCode = _getEntryPointCode(session, userModule);
+    SLANG_CHECK_ABORT(originalCode.getLength() != 0);
+
+    // Nothing has changed yet.
+    SlangInt invalidatedCount = -1;
+    SlangInt keptCount = -1;
+    SLANG_CHECK(SLANG_SUCCEEDED(session->invalidateStaleModules(&invalidatedCount, &keptCount)));
+    SLANG_CHECK(invalidatedCount == 0);
+    SLANG_CHECK(keptCount == loadedCount);
+
+    // Editing the base module invalidates it and the module that imports it, but
+    // not the unrelated one.
+    File::writeAllText(baseName + ".slang", "public int f() { return 3; }");
+    SLANG_CHECK(SLANG_SUCCEEDED(session->invalidateStaleModules(&invalidatedCount, &keptCount)));
+    SLANG_CHECK(invalidatedCount == 2);
+    SLANG_CHECK(keptCount == loadedCount - 2);
+    SLANG_CHECK(session->loadModule(otherName.getBuffer()) == otherModule);
+
+    auto reloadedUserModule = session->loadModule(userName.getBuffer());
+    SLANG_CHECK_ABORT(reloadedUserModule != nullptr);
+    SLANG_CHECK(reloadedUserModule != userModule.get());
+    SLANG_CHECK(session->getLoadedModuleCount() == loadedCount);
+
+    // Code generated from the reloaded module uses the edited source, and none of the IR
+    // lowered from the old source.
+    const String reloadedCode = _getEntryPointCode(session, reloadedUserModule);
+    SLANG_CHECK(reloadedCode.getLength() != 0);
+    SLANG_CHECK(reloadedCode != originalCode);
+
+    File::remove(baseName + ".slang");
+    File::remove(userName + ".slang");
+    File::remove(otherName + ".slang");
+}
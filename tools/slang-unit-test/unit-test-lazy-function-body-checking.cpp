@@ -0,0 +1,231 @@
+// unit-test-lazy-function-body-checking.cpp
+
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+using namespace Slang;
+
+// Test that `-lazy-function-body-checking` skips the bodies of functions that nothing
+// reachable refers to, while still checking the ones that are used, and that modules loaded
+// through `ISession` are always checked in full.
+
+/// Compile `source` with a compile request, generating code for the entry points it marks.
+/// Returns true if the compile succeeded.
+static bool _compileModule(
+    slang::IGlobalSession* globalSession,
+    const char* name,
+    const char* source,
+    bool lazy = true)
+{
+    ComPtr<slang::ICompileRequest> request;
+    SLANG_ALLOW_DEPRECATED_BEGIN
+    if (SLANG_FAILED(globalSession->createCompileRequest(request.writeRef())))
+        return false;
+    SLANG_ALLOW_DEPRECATED_END
+
+    const char* args[] = {"-target", "hlsl", "-profile", "sm_5_0", "-lazy-function-body-checking"};
+    const int argCount = SLANG_COUNT_OF(args) - (lazy ? 0 : 1);
+    if (SLANG_FAILED(request->processCommandLineArguments(args, argCount)))
+        return false;
+
+    String moduleName = name;
+    int translationUnitIndex =
+        request->addTranslationUnit(SLANG_SOURCE_LANGUAGE_SLANG, moduleName.getBuffer());
+    request->addTranslationUnitSourceString(
+        translationUnitIndex,
+        (moduleName + ".slang").getBuffer(),
+        source);
+    return SLANG_SUCCEEDED(request->compile());
+}
+
+static ComPtr<slang::ISession> _createLazySession(slang::IGlobalSession* globalSession)
+{
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = SLANG_HLSL;
+    targetDesc.profile = globalSession->findProfile("sm_5_0");
+
+    slang::CompilerOptionEntry entry;
+    entry.name = slang::CompilerOptionName::LazyFunctionBodyChecking;
+    entry.value.kind = slang::CompilerOptionValueKind::Int;
+    entry.value.intValue0 = 1;
+
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targetCount = 1;
+    sessionDesc.targets = &targetDesc;
+    sessionDesc.compilerOptionEntries = &entry;
+    sessionDesc.compilerOptionEntryCount = 1;
+
+    ComPtr<slang::ISession> session;
+    globalSession->createSession(sessionDesc, session.writeRef());
+    return session;
+}
+
+SLANG_UNIT_TEST(lazyFunctionBodyChecking)
+{
+    // `unused` has an error in its body, but is never called.
+    const char* unusedErrorSource = R"(
+        internal int unused() { return undefinedName; }
+        internal int helper(int x) { return x * 2; }
+
+        [shader("compute")]
+        [numthreads(1, 1, 1)]
+        void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<int> output)
+        {
+            output[tid.x] = helper(int(tid.x));
+        }
+        )";
+
+    // `broken` has an error in its body, and is reached through `helper`.
+    const char* usedErrorSource = R"(
+        internal int broken() { return undefinedName; }
+        internal int helper(int x) { return x * broken(); }
+
+        [shader("compute")]
+        [numthreads(1, 1, 1)]
+        void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<int> output)
+        {
+            output[tid.x] = helper(int(tid.x));
+        }
+        )";
+
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+
+    // Without the option, the error in the unused function is reported.
+    SLANG_CHECK(!_compileModule(globalSession, "unusedError", unusedErrorSource, false));
+
+    // With the option, the unused function is skipped, and the rest of the module
+    // still compiles.
+    SLANG_CHECK(_compileModule(globalSession, "unusedError", unusedErrorSource));
+
+    // Functions reached through other functions are still checked.
+    SLANG_CHECK(!_compileModule(globalSession, "usedError", usedErrorSource));
+
+    // Operator overloads are only found through the operators that use them, so they are
+    // always checked.
+    {
+        const char* operatorSource = R"(
+            struct Value { int v; }
+            internal Value operator+(Value a, Value b)
+            {
+                Value result;
+                result.v = a.v * 3 + b.v;
+                return result;
+            }
+
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<int> dest)
+            {
+                Value value = { int(tid.x) };
+                dest[tid.x] = (value + value).v;
+            }
+            )";
+        const char* operatorErrorSource = R"(
+            struct Value { int v; }
+            internal Value operator+(Value a, Value b)
+            {
+                Value result;
+                result.v = undefinedName;
+                return result;
+            }
+
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<int> dest)
+            {
+                Value value = { int(tid.x) };
+                dest[tid.x] = (value + value).v;
+            }
+            )";
+        SLANG_CHECK(_compileModule(globalSession, "operatorOverload", operatorSource));
+        SLANG_CHECK(!_compileModule(globalSession, "operatorOverloadError", operatorErrorSource));
+    }
+
+    // Functions in a namespace are reached through their qualified names.
+    {
+        const char* namespaceSource = R"(
+            namespace util
+            {
+                internal int scale(int x) { return x * 5; }
+                internal int unused() { return undefinedName; }
+            }
+
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<int> dest)
+            {
+                dest[tid.x] = util::scale(int(tid.x));
+            }
+            )";
+        const char* namespaceErrorSource = R"(
+            namespace util
+            {
+                internal int scale(int x) { return x * undefinedName; }
+            }
+
+            [shader("compute")]
+            [numthreads(1, 1, 1)]
+            void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<int> dest)
+            {
+                dest[tid.x] = util::scale(int(tid.x));
+            }
+            )";
+        SLANG_CHECK(_compileModule(globalSession, "qualifiedCall", namespaceSource));
+        SLANG_CHECK(!_compileModule(globalSession, "qualifiedCallError", namespaceErrorSource));
+    }
+
+    // A module loaded through `ISession` can have any function named as an entry point after
+    // it is loaded, so nothing in it is skipped.
+    {
+        auto session = _createLazySession(globalSession);
+        SLANG_CHECK_ABORT(session != nullptr);
+
+        ComPtr<slang::IBlob> diagnosticBlob;
+        auto errorModule = session->loadModuleFromSourceString(
+            "sessionUnusedError",
+            "sessionUnusedError.slang",
+            unusedErrorSource,
+            diagnosticBlob.writeRef());
+        SLANG_CHECK(errorModule == nullptr);
+
+        // `computeMain` has no attributes, and nothing in the module refers to it.
+        const char* lateEntryPointSource = R"(
+            internal int helper(int x) { return x * 2; }
+
+            void computeMain(uniform RWStructuredBuffer<int> output)
+            {
+                output[0] = helper(3);
+            }
+            )";
+        auto module = session->loadModuleFromSourceString(
+            "lateEntryPoint",
+            "lateEntryPoint.slang",
+            lateEntryPointSource,
+            diagnosticBlob.writeRef());
+        SLANG_CHECK_ABORT(module != nullptr);
+
+        ComPtr<slang::IEntryPoint> entryPoint;
+        module->findAndCheckEntryPoint(
+            "computeMain",
+            SLANG_STAGE_COMPUTE,
+            entryPoint.writeRef(),
+            diagnosticBlob.writeRef());
+        SLANG_CHECK_ABORT(entryPoint != nullptr);
+
+        slang::IComponentType* components[] = {module, entryPoint.get()};
+        ComPtr<slang::IComponentType> program;
+        session->createCompositeComponentType(components, 2, program.writeRef());
+        SLANG_CHECK_ABORT(program != nullptr);
+
+        ComPtr<slang::IComponentType> linkedProgram;
+        program->link(linkedProgram.writeRef(), diagnosticBlob.writeRef());
+        SLANG_CHECK_ABORT(linkedProgram != nullptr);
+
+        ComPtr<slang::IBlob> code;
+        linkedProgram->getEntryPointCode(0, 0, code.writeRef(), diagnosticBlob.writeRef());
+        SLANG_CHECK(code != nullptr);
+    }
+}
@@ -0,0 +1,96 @@
+// unit-test-llvm-jit-object-cache.cpp
+
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+#include <stdlib.h>
+
+using namespace Slang;
+
+// Test that JIT compiling a module through slang-llvm a second time finds its object code in the
+// process wide JIT object cache.
+
+struct LLVMJITObjectCacheCounts
+{
+    Int hitCount = -1;
+    Int missCount = -1;
+};
+
+static Int _readCount(const UnownedStringSlice& text, const UnownedStringSlice& prefix)
+{
+    const Index index = text.indexOf(prefix);
+    if (index < 0)
+        return -1;
+    return Int(atoll(text.begin() + index + prefix.getLength()));
+}
+
+/// JIT compile a small program, and call into it. Returns the cache counts reported by the
+/// compile.
+static LLVMJITObjectCacheCounts _compileAndRun(slang::IGlobalSession* globalSession)
+{
+    LLVMJITObjectCacheCounts counts;
+
+    ComPtr<slang::ICompileRequest> request;
+    SLANG_ALLOW_DEPRECATED_BEGIN
+    if (SLANG_FAILED(globalSession->createCompileRequest(request.writeRef())))
+        return counts;
+    SLANG_ALLOW_DEPRECATED_END
+
+    const char* source = R"(
+        export __extern_cpp int scaleAndOffset(int value)
+        {
+            return value * 3 + 1;
+        }
+        )";
+    const char* args[] = {
+        "-target",
+        "host-callable",
+        "-emit-cpu-via-llvm",
+        "-whole-program",
+        "-report-perf-benchmark"};
+    if (SLANG_FAILED(request->processCommandLineArguments(args, SLANG_COUNT_OF(args))))
+        return counts;
+    int translationUnitIndex =
+        request->addTranslationUnit(SLANG_SOURCE_LANGUAGE_SLANG, "llvmJITObjectCache");
+    request->addTranslationUnitSourceString(
+        translationUnitIndex,
+        "llvmJITObjectCache.slang",
+        source);
+    if (SLANG_FAILED(request->compile()))
+        return counts;
+
+    // The JIT compiles the module when a symbol is first looked up.
+    ComPtr<ISlangSharedLibrary> sharedLibrary;
+    if (SLANG_FAILED(request->getTargetHostCallable(0, sharedLibrary.writeRef())))
+        return counts;
+    typedef int (*Func)(int);
+    auto func = (Func)sharedLibrary->findFuncByName("scaleAndOffset");
+    if (!func || func(2) != 7)
+        return counts;
+
+    UnownedStringSlice output = UnownedStringSlice(request->getDiagnosticOutput());
+    counts.hitCount = _readCount(output, toSlice("LLVM JIT Object Cache: "));
+    counts.missCount = _readCount(output, toSlice(" hits, "));
+    return counts;
+}
+
+SLANG_UNIT_TEST(llvmJITObjectCache)
+{
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+    if (SLANG_FAILED(globalSession->checkPassThroughSupport(SLANG_PASS_THROUGH_LLVM)))
+        SLANG_IGNORE_TEST;
+
+    // Depending on when the JIT compiles the module, the counts reported by a compile may or may
+    // not include its own module. Either way the third compile reports a hit for an identical
+    // module, and at most the first module misses.
+    const auto first = _compileAndRun(globalSession);
+    const auto second = _compileAndRun(globalSession);
+    const auto third = _compileAndRun(globalSession);
+    SLANG_CHECK_ABORT(first.hitCount >= 0 && second.hitCount >= 0 && third.hitCount >= 0);
+
+    SLANG_CHECK(third.hitCount > second.hitCount);
+    SLANG_CHECK(third.missCount <= first.missCount + 1);
+}
@@ -1,6 +1,7 @@
 // unit-test-free-list.cpp
 
 #include "../../source/core/slang-list.h"
+#include "../../source/core/slang-memory-arena-pool.h"
 #include "../../source/core/slang-memory-arena.h"
 #include "../../source/core/slang-random-generator.h"
 #include "unit-test/slang-unit-test.h"
@@ -264,3 +265,76 @@ SLANG_UNIT_TEST(memoryArena)
         // Do lots of allocations and test out rewind
     }
 }
+
+SLANG_UNIT_TEST(memoryArenaPool)
+{
+    MemoryArenaPool::Desc desc;
+    desc.minBlockPayloadSize = 1024;
+    desc.maxBlockPayloadSize = 64 * 1024;
+    desc.maxPooledArenaCount = 2;
+
+    RefPtr<MemoryArenaPool> pool = new MemoryArenaPool(desc);
+
+    {
+        MemoryArena arena(1024);
+        pool->acquire(arena);
+        SLANG_CHECK(arena.getBlockPayloadSize() == 1024);
+
+        for (Index i = 0; i < 8; ++i)
+        {
+            ::memset(arena.allocate(512), 0xcd, 512);
+        }
+        pool->release(arena);
+    }
+
+    auto stats = pool->getStats();
+    SLANG_CHECK(stats.acquireCount == 1);
+    SLANG_CHECK(stats.releaseCount == 1);
+    SLANG_CHECK(stats.discardCount == 0);
+    SLANG_CHECK(stats.pooledBytes > 0);
+
+    {
+        // The next arena reuses the pooled blocks.
+        MemoryArena arena(1024);
+        pool->acquire(arena);
+        SLANG_CHECK(pool->getStats().reuseCount == 1);
+        SLANG_CHECK(pool->getStats().pooledBytes == 0);
+        SLANG_CHECK(arena.calcTotalMemoryUsed() == 0);
+        SLANG_CHECK(arena.calcTotalMemoryAllocated() >= 8 * 512);
+
+        // Grow the arena so that the average size pushes the block size up.
+        for (Index i = 0; i < 1024; ++i)
+        {
+            arena.allocate(512);
+        }
+        pool->release(arena);
+    }
+
+    stats = pool->getStats();
+    SLANG_CHECK(stats.blockPayloadSize > 1024);
+    SLANG_CHECK(stats.blockPayloadSize <= desc.maxBlockPayloadSize);
+
+    // The arena was built with the old block size, so it is not kept.
+    SLANG_CHECK(stats.discardCount == 1);
+
+    {
+        // New arenas use the adapted block size.
+        MemoryArena arena(1024);
+        pool->acquire(arena);
+        SLANG_CHECK(arena.getBlockPayloadSize() == stats.blockPayloadSize);
+        arena.allocate(512);
+        pool->release(arena);
+    }
+    SLANG_CHECK(pool->getStats().pooledBytes > 0);
+
+    // Trimming frees the pooled arenas, and the pool keeps working afterwards.
+    pool->trim();
+    SLANG_CHECK(pool->getStats().pooledBytes == 0);
+    {
+        MemoryArena arena(1024);
+        const UInt reuseCount = pool->getStats().reuseCount;
+        pool->acquire(arena);
+        SLANG_CHECK(pool->getStats().reuseCount == reuseCount);
+        pool->release(arena);
+    }
+}
@@ -0,0 +1,145 @@
+// unit-test-precompile-link-order.cpp
+
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+using namespace Slang;
+
+// Test that precompiling a module for a target and linking programs that use the module give the
+// same results whichever is done first. Precompiling temporarily marks the public functions of the
+// module as exported and relinks it, so it must not see (or leave behind) link information that the
+// linker cached for the module beforehand.
+
+static const char* kPrecompileLinkOrderSource = R"(
+    public float usedHelper(float x)
+    {
+        return x * 2.0;
+    }
+
+    public float unusedHelper(float x)
+    {
+        return x + 3.0;
+    }
+
+    [shader("compute")]
+    [numthreads(4, 1, 1)]
+    void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<float> output)
+    {
+        output[tid.x] = usedHelper(float(tid.x));
+    }
+    )";
+
+static String _linkAndGetCode(slang::ISession* session, slang::IModule* module)
+{
+    ComPtr<slang::IBlob> diagnosticBlob;
+    ComPtr<slang::IEntryPoint> entryPoint;
+    module->findEntryPointByName("computeMain", entryPoint.writeRef());
+    if (!entryPoint)
+        return String();
+
+    // Create a new program every time, so that nothing is reused from a previous link.
+    slang::IComponentType* components[] = {module, entryPoint.get()};
+    ComPtr<slang::IComponentType> program;
+    session->createCompositeComponentType(components, 2, program.writeRef());
+    if (!program)
+        return String();
+
+    ComPtr<slang::IComponentType> linkedProgram;
+    program->link(linkedProgram.writeRef(), diagnosticBlob.writeRef());
+    if (!linkedProgram)
+        return String();
+
+    ComPtr<slang::IBlob> code;
+    linkedProgram->getEntryPointCode(0, 0, code.writeRef(), diagnosticBlob.writeRef());
+    if (!code)
+        return String();
+    return String(UnownedStringSlice(
+        (const char*)code->getBufferPointer(),
+        (const char*)code->getBufferPointer() + code->getBufferSize()));
+}
+
+static ComPtr<slang::IBlob> _precompile(slang::IModule* module)
+{
+    ComPtr<slang::IModulePrecompileService_Experimental> precompileService;
+    if (SLANG_FAILED(module->queryInterface(
+            slang::SLANG_UUID_IModulePrecompileService_Experimental,
+            (void**)precompileService.writeRef())))
+        return nullptr;
+
+    ComPtr<slang::IBlob> diagnosticBlob;
+    auto result = precompileService->precompileForTarget(SLANG_SPIRV, diagnosticBlob.writeRef());
+    if (SLANG_FAILED(result))
+        return nullptr;
+
+    ComPtr<slang::IBlob> code;
+    precompileService->getPrecompiledTargetCode(SLANG_SPIRV, code.writeRef());
+    return code;
+}
+
+static slang::IModule* _loadModule(
+    slang::IGlobalSession* globalSession,
+    ComPtr<slang::ISession>& outSession)
+{
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = SLANG_HLSL;
+    targetDesc.profile = globalSession->findProfile("sm_6_0");
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targetCount = 1;
+    sessionDesc.targets = &targetDesc;
+    if (SLANG_FAILED(globalSession->createSession(sessionDesc, outSession.writeRef())))
+        return nullptr;
+
+    ComPtr<slang::IBlob> diagnosticBlob;
+    return outSession->loadModuleFromSourceString(
+        "precompileLinkOrder",
+        "precompileLinkOrder.slang",
+        kPrecompileLinkOrderSource,
+        diagnosticBlob.writeRef());
+}
+
+static bool _isSameBlob(slang::IBlob* a, slang::IBlob* b)
+{
+    return a->getBufferSize() == b->getBufferSize() &&
+           memcmp(a->getBufferPointer(), b->getBufferPointer(), a->getBufferSize()) == 0;
+}
+
+SLANG_UNIT_TEST(precompileLinkOrder)
+{
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+
+    // Precompile first, then link.
+    ComPtr<slang::ISession> precompileFirstSession;
+    auto precompileFirstModule = _loadModule(globalSession, precompileFirstSession);
+    SLANG_CHECK_ABORT(precompileFirstModule != nullptr);
+
+    auto precompiledFirst = _precompile(precompileFirstModule);
+    SLANG_CHECK_ABORT(precompiledFirst != nullptr);
+    String linkedAfterPrecompile = _linkAndGetCode(precompileFirstSession, precompileFirstModule);
+    SLANG_CHECK_ABORT(linkedAfterPrecompile.getLength() != 0);
+
+    // Link first, then precompile, then link again.
+    ComPtr<slang::ISession> linkFirstSession;
+    auto linkFirstModule = _loadModule(globalSession, linkFirstSession);
+    SLANG_CHECK_ABORT(linkFirstModule != nullptr);
+
+    String linkedBeforePrecompile = _linkAndGetCode(linkFirstSession, linkFirstModule);
+    SLANG_CHECK_ABORT(linkedBeforePrecompile.getLength() != 0);
+    auto precompiledSecond = _precompile(linkFirstModule);
+    SLANG_CHECK_ABORT(precompiledSecond != nullptr);
+    String relinkedAfterPrecompile = _linkAndGetCode(linkFirstSession, linkFirstModule);
+    SLANG_CHECK_ABORT(relinkedAfterPrecompile.getLength() != 0);
+
+    // Precompiling exports every public function, whether or not an earlier link has seen the
+    // module.
+    SLANG_CHECK(_isSameBlob(precompiledFirst, precompiledSecond));
+
+    // Linking a program only pulls in what its entry point uses, whether or not the module has
+    // been precompiled.
+    SLANG_CHECK(linkedAfterPrecompile.indexOf(toSlice("unusedHelper")) == -1);
+    SLANG_CHECK(linkedBeforePrecompile.indexOf(toSlice("unusedHelper")) == -1);
+    SLANG_CHECK(relinkedAfterPrecompile.indexOf(toSlice("unusedHelper")) == -1);
+    SLANG_CHECK(linkedAfterPrecompile == relinkedAfterPrecompile);
+}
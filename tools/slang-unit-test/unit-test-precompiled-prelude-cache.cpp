@@ -0,0 +1,147 @@
+// unit-test-precompiled-prelude-cache.cpp
+
+#include "../../source/core/slang-io.h"
+#include "../../source/core/slang-process.h"
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+using namespace Slang;
+
+// Test that `-precompiled-prelude-cache` builds a precompiled header from the C++ prelude when
+// compiling with gcc or clang, and that a header that fails to build is recorded as such.
+
+static const char* kPrecompiledPreludeSource = R"(
+    [shader("compute")]
+    [numthreads(4, 1, 1)]
+    void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<float> output)
+    {
+        output[tid.x] = float(tid.x) * 2.0;
+    }
+    )";
+
+/// Compile `kPrecompiledPreludeSource` to a shared library, with the precompiled prelude cached
+/// in `cacheDirectory`. Returns true if the library was produced.
+static bool _compileSharedLibrary(
+    slang::IGlobalSession* globalSession,
+    const String& cacheDirectory)
+{
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = SLANG_SHADER_SHARED_LIBRARY;
+
+    slang::CompilerOptionEntry entry;
+    entry.name = slang::CompilerOptionName::PrecompiledPreludeCachePath;
+    entry.value.kind = slang::CompilerOptionValueKind::String;
+    entry.value.stringValue0 = cacheDirectory.getBuffer();
+
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targetCount = 1;
+    sessionDesc.targets = &targetDesc;
+    sessionDesc.compilerOptionEntries = &entry;
+    sessionDesc.compilerOptionEntryCount = 1;
+
+    ComPtr<slang::ISession> session;
+    if (SLANG_FAILED(globalSession->createSession(sessionDesc, session.writeRef())))
+        return false;
+
+    ComPtr<slang::IBlob> diagnosticBlob;
+    auto module = session->loadModuleFromSourceString(
+        "precompiledPrelude",
+        "precompiledPrelude.slang",
+        kPrecompiledPreludeSource,
+        diagnosticBlob.writeRef());
+    if (!module)
+        return false;
+
+    ComPtr<slang::IEntryPoint> entryPoint;
+    module->findEntryPointByName("computeMain", entryPoint.writeRef());
+    if (!entryPoint)
+        return false;
+
+    slang::IComponentType* components[] = {module, entryPoint.get()};
+    ComPtr<slang::IComponentType> program;
+    session->createCompositeComponentType(components, 2, program.writeRef());
+    if (!program)
+        return false;
+
+    ComPtr<slang::IComponentType> linkedProgram;
+    program->link(linkedProgram.writeRef(), diagnosticBlob.writeRef());
+    if (!linkedProgram)
+        return false;
+
+    ComPtr<slang::IBlob> code;
+    linkedProgram->getEntryPointCode(0, 0, code.writeRef(), diagnosticBlob.writeRef());
+    return code != nullptr;
+}
+
+/// Returns the names of the files in `directory`.
+static List<String> _findFiles(const String& directory)
+{
+    struct Visitor : Path::Visitor
+    {
+        void accept(Path::Type type, const UnownedStringSlice& filename) SLANG_OVERRIDE
+        {
+            if (type == Path::Type::File)
+                m_fileNames.add(filename);
+        }
+        List<String> m_fileNames;
+    };
+
+    Visitor visitor;
+    Path::find(directory, nullptr, &visitor);
+    return visitor.m_fileNames;
+}
+
+static Count _countFilesWithSuffix(const List<String>& fileNames, const char* suffix)
+{
+    Count count = 0;
+    for (const auto& fileName : fileNames)
+    {
+        if (fileName.endsWith(suffix))
+            count++;
+    }
+    return count;
+}
+
+SLANG_UNIT_TEST(precompiledPreludeCache)
+{
+    const SlangPassThrough compilers[] = {SLANG_PASS_THROUGH_GCC, SLANG_PASS_THROUGH_CLANG};
+    for (auto compiler : compilers)
+    {
+        ComPtr<slang::IGlobalSession> globalSession;
+        SLANG_CHECK_ABORT(
+            slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+        if (SLANG_FAILED(globalSession->checkPassThroughSupport(compiler)))
+            continue;
+        globalSession->setDefaultDownstreamCompiler(SLANG_SOURCE_LANGUAGE_CPP, compiler);
+
+        const String cacheDirectory = Path::simplify(
+            Path::getParentDirectory(Path::getExecutablePath()) + "/precompiled-prelude-test" +
+            String(Process::getId()));
+        const char* pchSuffix = compiler == SLANG_PASS_THROUGH_CLANG ? ".h.pch" : ".h.gch";
+
+        // The first compile builds the precompiled header, the second one uses it.
+        SLANG_CHECK(_compileSharedLibrary(globalSession, cacheDirectory));
+        SLANG_CHECK(_compileSharedLibrary(globalSession, cacheDirectory));
+        {
+            const auto fileNames = _findFiles(cacheDirectory);
+            SLANG_CHECK(_countFilesWithSuffix(fileNames, ".h") == 1);
+            SLANG_CHECK(_countFilesWithSuffix(fileNames, pchSuffix) == 1);
+            SLANG_CHECK(_countFilesWithSuffix(fileNames, ".failed") == 0);
+        }
+
+        // A prelude that can't be built is recorded as failed, and isn't precompiled. The
+        // prelude is a different header, so it doesn't affect the one that was built above.
+        globalSession->setLanguagePrelude(SLANG_SOURCE_LANGUAGE_CPP, "#error prelude test\n");
+        SLANG_CHECK(!_compileSharedLibrary(globalSession, cacheDirectory));
+        SLANG_CHECK(!_compileSharedLibrary(globalSession, cacheDirectory));
+        {
+            const auto fileNames = _findFiles(cacheDirectory);
+            SLANG_CHECK(_countFilesWithSuffix(fileNames, ".h") == 2);
+            SLANG_CHECK(_countFilesWithSuffix(fileNames, pchSuffix) == 1);
+            SLANG_CHECK(_countFilesWithSuffix(fileNames, ".failed") == 1);
+        }
+
+        Path::removeNonEmpty(cacheDirectory);
+    }
+}
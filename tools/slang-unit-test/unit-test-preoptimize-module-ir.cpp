@@ -0,0 +1,113 @@
+// unit-test-preoptimize-module-ir.cpp
+
+#include "slang-com-ptr.h"
+#include "slang.h"
+#include "unit-test/slang-unit-test.h"
+
+using namespace Slang;
+
+// Test that `-preoptimize-module-ir` doesn't resolve calls through the default of an `extern`
+// type before linking, so that an `export` of the type in another module still overrides it.
+
+static String _compileWithOverride(slang::IGlobalSession* globalSession, bool preoptimize)
+{
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = SLANG_HLSL;
+    targetDesc.profile = globalSession->findProfile("sm_5_0");
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targetCount = 1;
+    sessionDesc.targets = &targetDesc;
+
+    slang::CompilerOptionEntry entry;
+    entry.name = slang::CompilerOptionName::PreoptimizeModuleIR;
+    entry.value.kind = slang::CompilerOptionValueKind::Int;
+    entry.value.intValue0 = 1;
+    if (preoptimize)
+    {
+        sessionDesc.compilerOptionEntries = &entry;
+        sessionDesc.compilerOptionEntryCount = 1;
+    }
+
+    ComPtr<slang::ISession> session;
+    if (SLANG_FAILED(globalSession->createSession(sessionDesc, session.writeRef())))
+        return String();
+
+    // `Foo` defaults to `DefaultFoo`, whose value is 7.
+    const char* librarySource = R"(
+        public interface IFoo { float getVal(); }
+        public struct DefaultFoo : IFoo { float getVal() { return 7.0; } }
+        public extern struct Foo : IFoo = DefaultFoo;
+
+        [shader("compute")]
+        [numthreads(1, 1, 1)]
+        void computeMain(uint3 tid : SV_DispatchThreadID, uniform RWStructuredBuffer<float> output)
+        {
+            Foo foo;
+            output[tid.x] = foo.getVal();
+        }
+        )";
+
+    // The config module overrides `Foo` with `MyFoo`, whose value is 42.
+    const char* configSource = R"(
+        import preoptimizeLibrary;
+        struct MyFoo : IFoo { float getVal() { return 42.0; } }
+        export struct Foo : IFoo = MyFoo;
+        )";
+
+    ComPtr<slang::IBlob> diagnosticBlob;
+    auto libraryModule = session->loadModuleFromSourceString(
+        "preoptimizeLibrary",
+        "preoptimizeLibrary.slang",
+        librarySource,
+        diagnosticBlob.writeRef());
+    if (!libraryModule)
+        return String();
+    auto configModule = session->loadModuleFromSourceString(
+        "preoptimizeConfig",
+        "preoptimizeConfig.slang",
+        configSource,
+        diagnosticBlob.writeRef());
+    if (!configModule)
+        return String();
+
+    ComPtr<slang::IEntryPoint> entryPoint;
+    libraryModule->findEntryPointByName("computeMain", entryPoint.writeRef());
+    if (!entryPoint)
+        return String();
+
+    slang::IComponentType* components[] = {libraryModule, configModule, entryPoint.get()};
+    ComPtr<slang::IComponentType> program;
+    session->createCompositeComponentType(components, 3, program.writeRef());
+    if (!program)
+        return String();
+
+    ComPtr<slang::IComponentType> linkedProgram;
+    program->link(linkedProgram.writeRef(), diagnosticBlob.writeRef());
+    if (!linkedProgram)
+        return String();
+
+    ComPtr<slang::IBlob> code;
+    linkedProgram->getEntryPointCode(0, 0, code.writeRef(), diagnosticBlob.writeRef());
+    if (!code)
+        return String();
+    return String(UnownedStringSlice(
+        (const char*)code->getBufferPointer(),
+        (const char*)code->getBufferPointer() + code->getBufferSize()));
+}
+
+SLANG_UNIT_TEST(preoptimizeModuleIRExternOverride)
+{
+    ComPtr<slang::IGlobalSession> globalSession;
+    SLANG_CHECK_ABORT(
+        slang_createGlobalSession(SLANG_API_VERSION, globalSession.writeRef()) == SLANG_OK);
+
+    for (bool preoptimize : {false, true})
+    {
+        String code = _compileWithOverride(globalSession, preoptimize);
+        SLANG_CHECK_ABORT(code.getLength() != 0);
+
+        // The exported `MyFoo` is used, not the default.
+        SLANG_CHECK(code.indexOf(toSlice("42.0")) != -1);
+        SLANG_CHECK(code.indexOf(toSlice("7.0")) == -1);
+    }
+}
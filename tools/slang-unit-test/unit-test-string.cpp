@@ -1,5 +1,6 @@
 // unit-test-path.cpp
 
+#include "../../source/core/slang-dictionary.h"
 #include "../../source/core/slang-string-util.h"
 #include "unit-test/slang-unit-test.h"
 
@@ -296,4 +297,30 @@ SLANG_UNIT_TEST(string)
             SLANG_CHECK(value == parsedValue);
         }
     }
+
+    {
+        // A key moved in from a `String` should hash the same as one built from a slice.
+        String name("_S3foo");
+        String nameCopy = name;
+        ImmutableHashedString movedKey(_Move(nameCopy));
+        ImmutableHashedString sliceKey(name.getUnownedSlice());
+        SLANG_CHECK(movedKey.getHashCode() == sliceKey.getHashCode());
+        SLANG_CHECK(movedKey == sliceKey);
+
+        // Lookups by slice should find keys added as owned strings.
+        Dictionary<
+            ImmutableHashedString,
+            int,
+            ImmutableHashedStringHash,
+            ImmutableHashedStringEqual>
+            map;
+        map.add(movedKey, 1);
+        map.add(ImmutableHashedString("_S3bar"), 2);
+
+        auto found = map.tryGetValue(UnownedStringSlice("_S3foo"));
+        SLANG_CHECK(found && *found == 1);
+        found = map.tryGetValue(UnownedStringSlice("_S3bar"));
+        SLANG_CHECK(found && *found == 2);
+        SLANG_CHECK(map.tryGetValue(UnownedStringSlice("_S3baz")) == nullptr);
+    }
 }